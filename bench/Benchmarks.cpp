@@ -0,0 +1,506 @@
+/*
+    @file           Benchmarks.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Benchmarks the graph operations on synthetic R-MAT, grid, DAG and tree graphs, and reports the results as JSON.
+    @details        Every operation is timed call by call, and reported with its throughput, latency percentiles and the peak resident set size
+    @details        of the process so far. Point-to-point queries (Dijkstra with a d-ary or a radix heap, bidirectional Dijkstra and ALT) are benchmarked on the grid.
+    @details        Graph construction and destruction are benchmarked with the default, pooled and monotonic memory resources.
+    @details        The R-MAT graph is also loaded into `BasicGraphWD` graphs of integral vertices and 32-bit weights, in sorted vectors and hash maps.
+    @details        The R-MAT and grid graphs are compressed, with the number of adjacency bytes as the result size of `compress`,
+    @details        and traversed both as a `GraphWDView` and as a `CompressedGraphWD`.
+    @note           Usage: `bench [scale] [seed] [output]`, defaulting to scale 14 (16384 vertices per graph), seed 42 and the standard output.
+    @note           Invalid arguments, or `--help`, print the usage instead.
+*/
+
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <random>
+#include <memory>
+#include <charconv>
+#include <fstream>
+#include <optional>
+#include <iostream>
+#include <algorithm>
+#include <string_view>
+#include <memory_resource>
+#include "Generators.hpp"
+#include "BasicGraphWD.hpp"
+#include "GraphWDView.hpp"
+#include "CompressedGraphWD.hpp"
+#include "LandmarkIndex.hpp"
+#include "DijkstraEngine.hpp"
+#include "BidirectionalDijkstraEngine.hpp"
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <sys/resource.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+//  @brief      The version of the JSON report, to be incremented whenever its fields change.
+static constexpr unsigned REPORT_VERSION = 2;
+
+//  @brief      The number of calls timed for whole-graph queries and traversals.
+static constexpr size_t TRAVERSAL_SAMPLES = 16;
+
+//  @brief      The number of calls timed for constant-time queries.
+static constexpr size_t QUERY_SAMPLES = 100000;
+
+//  @brief      The maximum number of removed vertices.
+static constexpr size_t REMOVAL_SAMPLES = 1000;
+
+//  @brief      The number of point-to-point queries, and of landmarks of ALT.
+static constexpr size_t POINT_TO_POINT_QUERIES = 500, LANDMARK_COUNT = 16;
+
+//  @brief      The range of accepted scales: the smallest grid has 2x2 vertices, and the vertex ids must fit in `VertexId_t`.
+static constexpr unsigned MIN_SCALE = 2, MAX_SCALE = 30;
+
+//  @brief      The usage of the benchmarks, printed on invalid arguments.
+static constexpr std::string_view USAGE = "Usage: bench [scale] [seed] [output], with a scale from 2 to 30 (default 14), an unsigned seed (default 42), and a report file (default the standard output).";
+
+//  @brief      Accumulates the results of the benchmarked calls, so that the compiler cannot discard them.
+static volatile size_t sink = 0;
+
+//  @struct     Result
+//  @brief      The measurements of an operation on a graph.
+struct Result
+{
+    std::string graph;
+    std::string operation;
+    size_t order;
+    size_t size;
+    std::vector<double> latencies;
+    double seconds;
+    double meanResultSize;
+    long peakRss;
+    long rssGrowth;
+};
+
+//  @brief      Gets the peak resident set size of the process in KiB, or `0` if the platform does not report it.
+static long getPeakRss(void)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#else
+    return 0;
+#endif
+}
+
+//  @brief      Gets the current resident set size of the process in KiB, or `0` if the platform does not report it.
+static long getCurrentRss(void)
+{
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    long pages = 0, residentPages = 0;
+    statm >> pages >> residentPages;
+    return residentPages * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+    return 0;
+#endif
+}
+
+/*
+    @brief      Times every call of an operation.
+    @param      graph The name of the graph family.
+    @param      operation The name of the operation.
+    @param      order The number of vertices of the graph.
+    @param      size The number of edges of the graph.
+    @param      samples The number of calls.
+    @param      call The callable invoked as `call(sample)` for every sample, returning the size of its result.
+    @returns    `Result` The measurements.
+*/
+template <typename Call>
+static Result measure(const std::string& graph, const std::string& operation, const size_t order, const size_t size, const size_t samples, Call&& call)
+{
+    Result result{ graph, operation, order, size, {}, 0, 0, 0, 0 };
+    result.latencies.reserve(samples);
+    size_t resultSize = 0;
+    const long startRss = getCurrentRss();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t sample = 0; sample < samples; ++sample)
+    {
+        const auto callStart = std::chrono::steady_clock::now();
+        resultSize += call(sample);
+        const std::chrono::duration<double, std::nano> latency = std::chrono::steady_clock::now() - callStart;
+        result.latencies.push_back(latency.count());
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    sink = sink + resultSize;
+    result.seconds = elapsed.count();
+    result.meanResultSize = samples != 0 ? static_cast<double>(resultSize) / static_cast<double>(samples) : 0;
+    result.peakRss = getPeakRss();
+    result.rssGrowth = getCurrentRss() - startRss;
+    std::sort(result.latencies.begin(), result.latencies.end());
+    std::cerr << graph << '\t' << operation << "\tsamples=" << samples << "\tops/s=" << samples / result.seconds << std::endl;
+    return result;
+}
+
+//  @brief      Gets the nearest-rank percentile of sorted latencies.
+static double getPercentile(const std::vector<double>& latencies, const double percentile)
+{
+    if (latencies.empty())
+        return 0;
+    const size_t rank = static_cast<size_t>(std::ceil(percentile * static_cast<double>(latencies.size())));
+    return latencies[std::clamp<size_t>(rank, 1, latencies.size()) - 1];
+}
+
+//  @brief      Writes the results as a JSON document.
+static void writeReport(std::ostream& output, const unsigned scale, const uint64_t seed, const std::vector<Result>& results)
+{
+    output << "{\n  \"version\": " << REPORT_VERSION << ",\n  \"scale\": " << scale << ",\n  \"seed\": " << seed
+        << ",\n  \"peak_rss_kib\": " << getPeakRss() << ",\n  \"results\": [";
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        const Result& result = results[index];
+        double mean = 0;
+        for (const double latency : result.latencies)
+            mean += latency;
+        mean /= std::max<size_t>(result.latencies.size(), 1);
+        output << (index != 0 ? "," : "") << "\n    {\"graph\": \"" << result.graph << "\", \"operation\": \"" << result.operation
+            << "\", \"vertices\": " << result.order << ", \"edges\": " << result.size << ", \"samples\": " << result.latencies.size()
+            << ", \"seconds\": " << result.seconds << ", \"ops_per_second\": " << (result.seconds > 0 ? result.latencies.size() / result.seconds : 0)
+            << ", \"latency_ns\": {\"mean\": " << mean << ", \"p50\": " << getPercentile(result.latencies, 0.5)
+            << ", \"p90\": " << getPercentile(result.latencies, 0.9) << ", \"p99\": " << getPercentile(result.latencies, 0.99)
+            << ", \"max\": " << (result.latencies.empty() ? 0 : result.latencies.back()) << "}, \"mean_result_size\": " << result.meanResultSize
+            << ", \"peak_rss_kib\": " << result.peakRss << ", \"rss_growth_kib\": " << result.rssGrowth << "}";
+    }
+    output << "\n  ]\n}" << std::endl;
+}
+
+/*
+    @brief      Benchmarks the operations of the graph on a given edge list.
+    @param      list The edge list.
+    @param      seed The seed of the sampled vertices.
+    @param      results The results to be appended to.
+    @returns    `GraphWD` The graph of the edge list.
+*/
+static GraphWD benchmarkOperations(const EdgeList& list, const uint64_t seed, std::vector<Result>& results)
+{
+    std::vector<Vertex_t> names(list.order);
+    for (VertexId_t vertex = 0; vertex < list.order; ++vertex)
+        names[vertex] = getGeneratedName(vertex);
+    std::mt19937_64 generator(seed);
+    const auto sampleVertices = [&](const size_t count)
+        {
+            std::vector<Vertex_t> sampled(count);
+            for (Vertex_t& vertex : sampled)
+                vertex = names[generator() % names.size()];
+            return sampled;
+        };
+
+    GraphWD graph;
+    for (const Vertex_t& name : names)
+        graph.insertVertex(name);
+    results.push_back(measure(list.name, "insertEdge", list.order, list.edges.size(), list.edges.size(), [&](const size_t sample)
+        {
+            const EdgeList::Edge& edge = list.edges[sample];
+            graph.insertEdge(names[edge.source], names[edge.destination], edge.weight);
+            return size_t(1);
+        }));
+    const size_t order = graph.getOrder(), size = graph.getSize();
+
+    const std::vector<Vertex_t> queried = sampleVertices(QUERY_SAMPLES);
+    results.push_back(measure(list.name, "getInDegree", order, size, queried.size(), [&](const size_t sample)
+        {
+            return graph.getInDegree(queried[sample]);
+        }));
+    const std::vector<Vertex_t> sources = sampleVertices(TRAVERSAL_SAMPLES);
+    results.push_back(measure(list.name, "getDFS", order, size, sources.size(), [&](const size_t sample)
+        {
+            return graph.getDFS(sources[sample]).size();
+        }));
+    results.push_back(measure(list.name, "getBFS", order, size, sources.size(), [&](const size_t sample)
+        {
+            return graph.getBFS(sources[sample]).size();
+        }));
+    results.push_back(measure(list.name, "getDijkstraShortestPaths", order, size, sources.size(), [&](const size_t sample)
+        {
+            return graph.getDijkstraShortestPaths(sources[sample]).size();
+        }));
+    std::vector<VertexId_t> sourceIds;
+    for (const Vertex_t& source : sources)
+        sourceIds.push_back(graph.getVertexId(source));
+    graph.setShortestPathCache(sourceIds.size(), SIZE_MAX);
+    for (const VertexId_t source : sourceIds)
+        graph.getDijkstraShortestPaths(source);
+    results.push_back(measure(list.name, "cachedDijkstraShortestPaths", order, size, sourceIds.size(), [&](const size_t sample)
+        {
+            return graph.getDijkstraShortestPaths(sourceIds[sample]).size();
+        }));
+    graph.setShortestPathCache(0, 0);
+    results.push_back(measure(list.name, "getKahnTopologicalSort", order, size, TRAVERSAL_SAMPLES, [&](const size_t)
+        {
+            return graph.getKahnTopologicalSort().second.size();
+        }));
+    results.push_back(measure(list.name, "isTree", order, size, TRAVERSAL_SAMPLES, [&](const size_t)
+        {
+            return static_cast<size_t>(graph.isTree().first);
+        }));
+
+    GraphWD copy = graph;
+    std::vector<Vertex_t> removed(std::min(names.size(), REMOVAL_SAMPLES));
+    for (size_t index = 0; index < removed.size(); ++index)
+    {
+        std::swap(names[index], names[index + generator() % (names.size() - index)]);
+        removed[index] = names[index];
+    }
+    results.push_back(measure(list.name, "removeVertex", order, size, removed.size(), [&](const size_t sample)
+        {
+            copy.removeVertex(removed[sample]);
+            return size_t(1);
+        }));
+    return graph;
+}
+
+/*
+    @brief      Benchmarks the operations of a graph of integral vertices and compact weights on a given edge list.
+    @tparam     Graph The instantiation of `BasicGraphWD`, of integral vertices.
+    @param      list The edge list.
+    @param      storage The name of the storage policy, appended to the name of the graph family.
+    @param      seed The seed of the sampled vertices.
+    @param      results The results to be appended to.
+*/
+template <typename Graph>
+static void benchmarkCompactOperations(const EdgeList& list, const std::string& storage, const uint64_t seed, std::vector<Result>& results)
+{
+    const std::string name = list.name + "/" + storage;
+    std::mt19937_64 generator(seed);
+    Graph graph;
+    for (VertexId_t vertex = 0; vertex < list.order; ++vertex)
+        graph.insertVertex(vertex);
+    results.push_back(measure(name, "insertEdge", list.order, list.edges.size(), list.edges.size(), [&](const size_t sample)
+        {
+            const EdgeList::Edge& edge = list.edges[sample];
+            graph.insertEdge(edge.source, edge.destination, static_cast<std::uint32_t>(edge.weight));
+            return size_t(1);
+        }));
+    std::vector<VertexId_t> sources(TRAVERSAL_SAMPLES);
+    for (VertexId_t& source : sources)
+        source = static_cast<VertexId_t>(generator() % list.order);
+    results.push_back(measure(name, "getBFS", graph.getOrder(), graph.getSize(), sources.size(), [&](const size_t sample)
+        {
+            return graph.getBFS(sources[sample]).size();
+        }));
+    results.push_back(measure(name, "getDijkstraShortestPaths", graph.getOrder(), graph.getSize(), sources.size(), [&](const size_t sample)
+        {
+            return graph.getDijkstraShortestPaths(sources[sample]).size();
+        }));
+}
+
+/*
+    @brief      Benchmarks the construction and the destruction of the graph of a given edge list, with the default, pooled and monotonic memory resources.
+    @param      list The edge list.
+    @param      results The results to be appended to.
+    @note       Freed memory is returned to the system before every construction where the platform allows it, so that the growth of
+    @note       the resident set size of every construction is measured from the same baseline.
+*/
+static void benchmarkMemoryResources(const EdgeList& list, std::vector<Result>& results)
+{
+    std::vector<Vertex_t> names(list.order);
+    for (VertexId_t vertex = 0; vertex < list.order; ++vertex)
+        names[vertex] = getGeneratedName(vertex);
+    for (const std::string resourceName : { "default", "pool", "monotonic" })
+    {
+        std::unique_ptr<std::pmr::memory_resource> resource;
+        if (resourceName == "pool")
+            resource = std::make_unique<std::pmr::unsynchronized_pool_resource>();
+        else if (resourceName == "monotonic")
+            resource = std::make_unique<std::pmr::monotonic_buffer_resource>();
+        const std::string graphName = list.name + "/" + resourceName;
+        std::optional<GraphWD> graph;
+#ifdef __GLIBC__
+        malloc_trim(0);
+#endif
+        results.push_back(measure(graphName, "build", list.order, list.edges.size(), 1, [&](const size_t)
+            {
+                graph.emplace(resource != nullptr ? resource.get() : std::pmr::get_default_resource());
+                for (const Vertex_t& name : names)
+                    graph->insertVertex(name);
+                for (const EdgeList::Edge& edge : list.edges)
+                    graph->insertEdge(names[edge.source], names[edge.destination], edge.weight);
+                return graph->getSize();
+            }));
+        results.push_back(measure(graphName, "teardown", list.order, list.edges.size(), 1, [&](const size_t)
+            {
+                graph.reset();
+                resource.reset();
+                return size_t(1);
+            }));
+    }
+}
+
+/*
+    @brief      Benchmarks the compression of a given graph, and the traversals of its compressed and compressed-sparse-row snapshots.
+    @param      graph The graph.
+    @param      name The name of the graph family.
+    @param      seed The seed of the sampled vertices.
+    @param      results The results to be appended to.
+*/
+static void benchmarkCompressed(const GraphWD& graph, const std::string& name, const uint64_t seed, std::vector<Result>& results)
+{
+    const size_t order = graph.getOrder(), size = graph.getSize();
+    std::mt19937_64 generator(seed);
+    std::vector<VertexId_t> sources;
+    while (sources.size() < TRAVERSAL_SAMPLES)
+    {
+        const VertexId_t source = static_cast<VertexId_t>(generator() % graph.getIdBound());
+        if (graph.containsVertex(source))
+            sources.push_back(source);
+    }
+    std::optional<CompressedGraphWD> compressed;
+    results.push_back(measure(name, "compress", order, size, 1, [&](const size_t)
+        {
+            compressed.emplace(graph.compress());
+            return compressed->getAdjacencyBytes();
+        }));
+    const GraphWDView view = graph.freeze();
+    results.push_back(measure(name + "/view", "getBFS", order, size, sources.size(), [&](const size_t sample)
+        {
+            return view.getBFS(sources[sample]).size();
+        }));
+    results.push_back(measure(name + "/compressed", "getBFS", order, size, sources.size(), [&](const size_t sample)
+        {
+            return compressed->getBFS(sources[sample]).size();
+        }));
+    results.push_back(measure(name + "/view", "getDijkstraShortestPaths", order, size, sources.size(), [&](const size_t sample)
+        {
+            return view.getDijkstraShortestPaths(sources[sample]).size();
+        }));
+    results.push_back(measure(name + "/compressed", "getDijkstraShortestPaths", order, size, sources.size(), [&](const size_t sample)
+        {
+            return compressed->getDijkstraShortestPaths(sources[sample]).size();
+        }));
+}
+
+/*
+    @brief      Benchmarks point-to-point queries with unidirectional Dijkstra (on both queues), bidirectional Dijkstra and ALT.
+    @param      graph The graph.
+    @param      name The name of the graph family.
+    @param      seed The seed of the sampled queries.
+    @param      results The results to be appended to.
+    @returns    `bool` Whether every search found the same distances.
+*/
+static bool benchmarkPointToPoint(const GraphWD& graph, const std::string& name, const uint64_t seed, std::vector<Result>& results)
+{
+    const size_t order = graph.getOrder(), size = graph.getSize();
+    std::mt19937_64 generator(seed);
+    std::vector<std::pair<VertexId_t, VertexId_t>> pairs(POINT_TO_POINT_QUERIES);
+    for (auto& [source, target] : pairs)
+        source = static_cast<VertexId_t>(generator() % order), target = static_cast<VertexId_t>(generator() % order);
+
+    LandmarkIndex landmarks;
+    results.push_back(measure(name, "buildLandmarks", order, size, 1, [&](const size_t)
+        {
+            landmarks.build(graph, LandmarkIndex::selectFarthestLandmarks(graph, LANDMARK_COUNT));
+            return LANDMARK_COUNT;
+        }));
+    DijkstraEngine<> dijkstra;
+    DijkstraEngine<RadixHeap> radix;
+    BidirectionalDijkstraEngine<> bidirectional;
+    DijkstraEngine<> alt;
+    std::vector<size_t> expected(pairs.size());
+    bool isAgreeing = true;
+    results.push_back(measure(name, "pointToPointDijkstra", order, size, pairs.size(), [&](const size_t sample)
+        {
+            const auto [source, target] = pairs[sample];
+            dijkstra.run(graph, source, { target });
+            expected[sample] = dijkstra.getDistance(target);
+            return dijkstra.getSettled().size();
+        }));
+    results.push_back(measure(name, "pointToPointRadix", order, size, pairs.size(), [&](const size_t sample)
+        {
+            const auto [source, target] = pairs[sample];
+            radix.run(graph, source, { target });
+            isAgreeing &= radix.getDistance(target) == expected[sample];
+            return radix.getSettled().size();
+        }));
+    results.push_back(measure(name, "pointToPointBidirectional", order, size, pairs.size(), [&](const size_t sample)
+        {
+            const auto [source, target] = pairs[sample];
+            bidirectional.run(graph, source, target);
+            isAgreeing &= bidirectional.getDistance() == expected[sample];
+            return bidirectional.getSettledCount();
+        }));
+    results.push_back(measure(name, "pointToPointAlt", order, size, pairs.size(), [&](const size_t sample)
+        {
+            const auto [source, target] = pairs[sample];
+            alt.runAStar(graph, source, target, [&](const VertexId_t vertex) { return landmarks.getLowerBound(vertex, target); });
+            isAgreeing &= alt.getDistance(target) == expected[sample];
+            return alt.getSettled().size();
+        }));
+    return isAgreeing;
+}
+
+/*
+    @brief      Parses a given command line argument as an unsigned integer.
+    @param      argument The command line argument to be parsed.
+    @param      maximum The maximum accepted value.
+    @returns    `std::optional<uint64_t>` The parsed value, or `std::nullopt` if the argument is not an integer from 0 to the maximum.
+*/
+static std::optional<uint64_t> parseArgument(const std::string_view argument, const uint64_t maximum)
+{
+    uint64_t value = 0;
+    const auto [end, error] = std::from_chars(argument.data(), argument.data() + argument.size(), value);
+    if (error != std::errc() || end != argument.data() + argument.size() || value > maximum)
+        return std::nullopt;
+    return value;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && (std::string_view(argv[1]) == "--help" || std::string_view(argv[1]) == "-h"))
+    {
+        std::cout << USAGE << std::endl;
+        return 0;
+    }
+    const std::optional<uint64_t> scaleArgument = argc > 1 ? parseArgument(argv[1], MAX_SCALE) : 14;
+    const std::optional<uint64_t> seedArgument = argc > 2 ? parseArgument(argv[2], UINT64_MAX) : 42;
+    if (argc > 4 || !scaleArgument.has_value() || *scaleArgument < MIN_SCALE || !seedArgument.has_value())
+    {
+        std::cerr << USAGE << std::endl;
+        return 2;
+    }
+    std::ofstream file;
+    if (argc > 3)
+    {
+        file.open(argv[3]);
+        if (!file)
+        {
+            std::cerr << "Cannot open the report file `" << argv[3] << "`." << std::endl;
+            return 1;
+        }
+    }
+    const unsigned scale = static_cast<unsigned>(*scaleArgument);
+    const uint64_t seed = *seedArgument;
+    const size_t order = size_t(1) << scale;
+    std::vector<Result> results;
+    const EdgeList rmat = makeRmat(scale, 8, seed);
+    benchmarkMemoryResources(rmat, results);
+    const GraphWD rmatGraph = benchmarkOperations(rmat, seed, results);
+    benchmarkCompressed(rmatGraph, rmat.name, seed, results);
+    benchmarkCompactOperations<BasicGraphWD<VertexId_t, std::uint32_t, SortedVectorStorage>>(rmat, "sortedVector", seed, results);
+    benchmarkCompactOperations<BasicGraphWD<VertexId_t, std::uint32_t, HashMapStorage>>(rmat, "hashMap", seed, results);
+    const GraphWD grid = benchmarkOperations(makeGrid(size_t(1) << (scale / 2), seed), seed, results);
+    const bool isAgreeing = benchmarkPointToPoint(grid, "grid", seed, results);
+    benchmarkCompressed(grid, "grid", seed, results);
+    benchmarkOperations(makeDag(order, 4, seed), seed, results);
+    benchmarkOperations(makeTree(order, seed), seed, results);
+
+    writeReport(argc > 3 ? static_cast<std::ostream&>(file) : std::cout, scale, seed, results);
+    if (!isAgreeing)
+    {
+        std::cerr << "Distances disagree between searches." << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*
+    @file           Generators.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the deterministic generators of synthetic graphs declared in `Generators.hpp`.
+*/
+
+#include <numeric>
+#include <unordered_set>
+#include "Generators.hpp"
+
+namespace
+{
+    //  @brief      The largest generated weight.
+    constexpr uint64_t MAX_WEIGHT = 100;
+
+    //  @class      SplitMix64
+    //  @brief      A small pseudo-random generator with a fully specified output, unlike the distributions of `<random>`.
+    class SplitMix64 final
+    {
+    private:
+        uint64_t state;
+
+    public:
+        explicit SplitMix64(const uint64_t seed) noexcept : state(seed) {}
+
+        //  @brief      Gets the next 64 random bits.
+        uint64_t next(void) noexcept
+        {
+            uint64_t value = (this->state += 0x9E3779B97F4A7C15ULL);
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+            return value ^ (value >> 31);
+        }
+
+        //  @brief      Gets a random integer in `[0, bound)`.
+        uint64_t below(const uint64_t bound) noexcept
+        {
+            return this->next() % bound;
+        }
+
+        //  @brief      Gets a random probability in `[0, 1)`.
+        double probability(void) noexcept
+        {
+            return static_cast<double>(this->next() >> 11) * 0x1.0p-53;
+        }
+
+        //  @brief      Gets a random weight in `[1, MAX_WEIGHT]`.
+        size_t weight(void) noexcept
+        {
+            return static_cast<size_t>(1 + this->below(MAX_WEIGHT));
+        }
+    };
+
+    //  @brief      Gets a random permutation of `[0, order)`, used to relabel the generated vertices.
+    std::vector<VertexId_t> getPermutation(const size_t order, SplitMix64& generator)
+    {
+        std::vector<VertexId_t> permutation(order);
+        std::iota(permutation.begin(), permutation.end(), VertexId_t(0));
+        for (size_t index = order; index > 1; --index)
+            std::swap(permutation[index - 1], permutation[generator.below(index)]);
+        return permutation;
+    }
+
+    //  @class      EdgeCollector
+    //  @brief      Appends the generated edges to an edge list, skipping self-loops and duplicates.
+    class EdgeCollector final
+    {
+    private:
+        EdgeList& list;
+        std::unordered_set<uint64_t> seen;
+
+    public:
+        explicit EdgeCollector(EdgeList& list) : list(list) {}
+
+        void add(const VertexId_t source, const VertexId_t destination, const size_t weight)
+        {
+            if (source != destination && this->seen.insert((static_cast<uint64_t>(source) << 32) | destination).second)
+                this->list.edges.push_back({ source, destination, weight });
+        }
+    };
+}
+
+EdgeList makeRmat(const unsigned scale, const size_t edgeFactor, const uint64_t seed)
+{
+    constexpr double A = 0.57, B = 0.19, C = 0.19;
+    SplitMix64 generator(seed);
+    EdgeList list{ "rmat", size_t(1) << scale, {} };
+    const std::vector<VertexId_t> labels = getPermutation(list.order, generator);
+    EdgeCollector collector(list);
+    for (size_t edge = 0; edge < list.order * edgeFactor; ++edge)
+    {
+        VertexId_t source = 0, destination = 0;
+        for (unsigned bit = 0; bit < scale; ++bit)
+        {
+            const double quadrant = generator.probability();
+            source = (source << 1) | (quadrant >= A + B);
+            destination = (destination << 1) | ((quadrant >= A && quadrant < A + B) || quadrant >= A + B + C);
+        }
+        collector.add(labels[source], labels[destination], generator.weight());
+    }
+    return list;
+}
+
+EdgeList makeGrid(const size_t side, const uint64_t seed)
+{
+    SplitMix64 generator(seed);
+    EdgeList list{ "grid", side * side, {} };
+    EdgeCollector collector(list);
+    for (VertexId_t vertex = 0; vertex < list.order; ++vertex)
+    {
+        if ((vertex + 1) % side != 0)
+        {
+            collector.add(vertex, vertex + 1, generator.weight());
+            collector.add(vertex + 1, vertex, generator.weight());
+        }
+        if (vertex + side < list.order)
+        {
+            collector.add(vertex, static_cast<VertexId_t>(vertex + side), generator.weight());
+            collector.add(static_cast<VertexId_t>(vertex + side), vertex, generator.weight());
+        }
+    }
+    return list;
+}
+
+EdgeList makeDag(const size_t order, const size_t edgesPerVertex, const uint64_t seed)
+{
+    SplitMix64 generator(seed);
+    EdgeList list{ "dag", order, {} };
+    const std::vector<VertexId_t> labels = getPermutation(order, generator);
+    EdgeCollector collector(list);
+    for (size_t vertex = 0; vertex + 1 < order; ++vertex)
+        for (size_t edge = 0; edge < edgesPerVertex; ++edge)
+            collector.add(labels[vertex], labels[vertex + 1 + generator.below(order - vertex - 1)], generator.weight());
+    return list;
+}
+
+EdgeList makeTree(const size_t order, const uint64_t seed)
+{
+    SplitMix64 generator(seed);
+    EdgeList list{ "tree", order, {} };
+    const std::vector<VertexId_t> labels = getPermutation(order, generator);
+    EdgeCollector collector(list);
+    for (size_t vertex = 1; vertex < order; ++vertex)
+        collector.add(labels[generator.below(vertex)], labels[vertex], generator.weight());
+    return list;
+}
+
+Vertex_t getGeneratedName(const VertexId_t vertex)
+{
+    return std::to_string(vertex);
+}
@@ -0,0 +1,78 @@
+/*
+    @headerfile     Generators.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Declares deterministic generators of synthetic graphs for the benchmarks.
+    @details        Every generator is driven by its own SplitMix64 stream, so that a given scale and seed yield the same graph
+    @details        on every platform and standard library, unlike the distributions of `<random>`.
+*/
+
+#ifndef __GENERATORS_HPP_
+#define __GENERATORS_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "GraphWD.hpp"
+
+//  @struct     EdgeList
+//  @brief      A generated graph, with vertices `0` to `order - 1` and edges free of self-loops and duplicates, in generation order.
+struct EdgeList
+{
+    //  @struct     Edge
+    //  @brief      A generated edge.
+    struct Edge
+    {
+        VertexId_t source;
+        VertexId_t destination;
+        size_t weight;
+    };
+
+    std::string name;
+    size_t order = 0;
+    std::vector<Edge> edges;
+};
+
+/*
+    @brief      Generates an R-MAT (Kronecker) graph, with the skewed degrees of social and web graphs.
+    @param      scale The base-2 logarithm of the number of vertices.
+    @param      edgeFactor The number of generated edges per vertex, before removing self-loops and duplicates.
+    @param      seed The seed of the generator.
+    @returns    `EdgeList` The graph, with quadrant probabilities (0.57, 0.19, 0.19, 0.05), shuffled vertex labels and weights in [1, 100].
+*/
+EdgeList makeRmat(const unsigned scale, const size_t edgeFactor, const uint64_t seed);
+
+/*
+    @brief      Generates a bidirected 2D grid, resembling a road network.
+    @param      side The number of vertices on each side of the grid.
+    @param      seed The seed of the generator.
+    @returns    `EdgeList` The graph, with weights in [1, 100] drawn independently for both directions.
+*/
+EdgeList makeGrid(const size_t side, const uint64_t seed);
+
+/*
+    @brief      Generates a random directed acyclic graph.
+    @param      order The number of vertices.
+    @param      edgesPerVertex The number of generated edges leaving each vertex, before removing duplicates.
+    @param      seed The seed of the generator.
+    @returns    `EdgeList` The graph, of which the vertex labels are shuffled so that they are not a topological order.
+*/
+EdgeList makeDag(const size_t order, const size_t edgesPerVertex, const uint64_t seed);
+
+/*
+    @brief      Generates a random recursive tree, where every vertex but the root has a parent chosen uniformly among the previous ones.
+    @param      order The number of vertices.
+    @param      seed The seed of the generator.
+    @returns    `EdgeList` The tree, with edges directed away from the root and shuffled vertex labels.
+*/
+EdgeList makeTree(const size_t order, const uint64_t seed);
+
+/*
+    @brief      Names a generated vertex, as inserted in the benchmarked graphs.
+    @param      vertex The generated vertex.
+    @returns    `Vertex_t` The name of the vertex.
+*/
+Vertex_t getGeneratedName(const VertexId_t vertex);
+
+#endif // __GENERATORS_HPP_
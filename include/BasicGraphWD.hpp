@@ -0,0 +1,55 @@
+/*
+    @headerfile     BasicGraphWD.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the generic weighted and directed graph `BasicGraphWD`, parameterized at compile time by its vertex, weight and storage types.
+    @details        - Integral vertices are their own ids: they are neither hashed nor interned, and should be dense, since arrays are sized by the largest one.
+    @details          Other vertices are interned to dense ids, and every method taking vertices then has an id-based overload.
+    @details        - Weights are of any unsigned integral type, so that `std::uint32_t` or `std::uint16_t` weights shrink the edges of compact storages.
+    @details        - Edges are stored by the storage policy, see `StoragePolicies.hpp`, in both directions so that removals cost O(degree) updates.
+    @details        The vertices, the edges, their validation and mutations, and the algorithms are implemented by `GraphWDCore`, see `GraphWDCore.hpp`,
+    @details        running the kernels of `GraphKernels.hpp` and of the engines, instantiated for the edge scan of the chosen storage.
+    @details        `GraphWD`, the graph of string vertices, `size_t` weights and ordered maps, is a specialization deriving from the same core,
+    @details        which adds the caches, landmarks and persistence of the library, defined in `GraphWD.hpp`.
+    @details        Common instantiations are compiled once in `BasicGraphWD.cpp`.
+*/
+
+#ifndef __BASIC_GRAPH_WD_HPP_
+#define __BASIC_GRAPH_WD_HPP_
+
+#include <cstdint>
+#include <memory_resource>
+#include "GraphWD.hpp"
+#include "GraphWDCore.hpp"
+#include "StoragePolicies.hpp"
+
+/*
+    @class      BasicGraphWD
+    @brief      Defines a weighted and directed graph data structure containing neither self-loops nor duplicate edges.
+    @tparam     VertexT The type of the vertices, integral or hashable.
+    @tparam     WeightT The unsigned integral type of the weights.
+    @tparam     StoragePolicy The storage of the edges, one of `MapStorage`, `SortedVectorStorage`, `HashMapStorage` and `CsrStorage`.
+    @note       Distances are computed as `size_t`, whatever the type of the weights.
+*/
+template <typename VertexT, typename WeightT, typename StoragePolicy>
+class BasicGraphWD final : public GraphWDCore<BasicGraphWD<VertexT, WeightT, StoragePolicy>, VertexT, WeightT, StoragePolicy>
+{
+public:
+    //  @brief      Creates an empty graph allocating from the default memory resource, `std::pmr::get_default_resource()`.
+    BasicGraphWD(void) = default;
+
+    //  @brief      Creates an empty graph allocating its vertex and edge containers from a given memory resource, which must outlive the graph.
+    explicit BasicGraphWD(std::pmr::memory_resource* const resource)
+        : GraphWDCore<BasicGraphWD, VertexT, WeightT, StoragePolicy>(resource)
+    {
+    }
+};
+
+extern template class GraphWDCore<BasicGraphWD<VertexId_t, std::uint32_t, SortedVectorStorage>, VertexId_t, std::uint32_t, SortedVectorStorage>;
+extern template class GraphWDCore<BasicGraphWD<VertexId_t, std::uint16_t, SortedVectorStorage>, VertexId_t, std::uint16_t, SortedVectorStorage>;
+extern template class GraphWDCore<BasicGraphWD<VertexId_t, std::uint32_t, HashMapStorage>, VertexId_t, std::uint32_t, HashMapStorage>;
+extern template class GraphWDCore<BasicGraphWD<VertexId_t, std::uint32_t, CsrStorage>, VertexId_t, std::uint32_t, CsrStorage>;
+extern template class GraphWDCore<BasicGraphWD<Vertex_t, std::uint32_t, SortedVectorStorage>, Vertex_t, std::uint32_t, SortedVectorStorage>;
+
+#endif // __BASIC_GRAPH_WD_HPP_
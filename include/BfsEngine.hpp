@@ -0,0 +1,335 @@
+/*
+    @headerfile     BfsEngine.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines a parallel, direction-optimizing breadth-first search engine computing BFS trees (depths and parents).
+    @details        A level is expanded either top-down, every frontier vertex claiming its unvisited neighbors, or bottom-up, every unvisited
+    @details        vertex looking for a parent among its predecessors in the frontier and stopping at the first one found. Following Beamer's
+    @details        heuristic, the search switches to bottom-up when the frontier has more than `1 / ALPHA` of the unexplored edges, and
+    @details        back to top-down when the frontier shrinks below `1 / BETA` of the vertices. Visited sets and bottom-up frontiers are bitmaps.
+    @note           Bottom-up steps need `forEachPredecessor`: graphs without it are only searched top-down.
+    @note           An engine is not thread-safe: every thread must use its own, e.g. through `getThreadLocalBfsEngine()`.
+*/
+
+#ifndef __BFS_ENGINE_HPP_
+#define __BFS_ENGINE_HPP_
+
+#include <bit>
+#include <tuple>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include "GraphWDTypes.hpp"
+#include "ThreadPool.hpp"
+
+/*
+    @class      BfsEngine
+    @brief      Solves single-source breadth-first searches, optionally on a thread pool, recording the depth and the parent of every reached vertex.
+    @note       Depths are unique, but parents (and frontier orders) may differ between parallel runs, since any parent one level up is valid.
+*/
+class BfsEngine final
+{
+public:
+    //  @brief      The threshold of Beamer's heuristic to switch to bottom-up: frontier edges over unexplored edges.
+    static constexpr size_t ALPHA = 14;
+
+    //  @brief      The threshold of Beamer's heuristic to switch back to top-down: vertices over frontier vertices.
+    static constexpr size_t BETA = 24;
+
+    //  @brief      The number of edges under which a search is not worth running on several threads.
+    static constexpr size_t PARALLEL_MIN_EDGES = 1 << 16;
+
+private:
+    //  @brief      The number of frontier vertices, or bitmap words, handled by each task of the pool.
+    static constexpr size_t GRAIN = 256;
+
+    //  @struct     Worker
+    //  @brief      The next frontier and counters of one worker thread, aligned to its own cache lines.
+    struct alignas(64) Worker
+    {
+        std::vector<VertexId_t> next;
+        size_t vertices = 0;
+        size_t edges = 0;
+    };
+
+    std::unique_ptr<std::atomic<std::uint64_t>[]> visited;
+    std::vector<std::uint64_t> frontierBits;
+    std::vector<std::uint64_t> nextBits;
+    std::vector<VertexId_t> frontier;
+    std::vector<std::uint32_t> depths;
+    std::vector<VertexId_t> parents;
+    std::vector<Worker> workers;
+    size_t wordCapacity = 0;
+    size_t wordCount = 0;
+    VertexId_t idBound = 0;
+    size_t reachedCount = 0;
+    size_t bottomUpSteps = 0;
+    ThreadPool* pool = nullptr;
+
+    //  @brief      Calls a given function on every index in `[0, count)`, on the pool if any and if there is enough work.
+    template <typename Function>
+    void forEachIndex(const size_t count, Function&& function)
+    {
+        if (this->pool != nullptr && count > GRAIN)
+            this->pool->parallelFor(0, count, GRAIN, function);
+        else
+            for (size_t index = 0; index < count; ++index)
+                function(index);
+    }
+
+    //  @brief      Gets the worker state of the calling thread. The calling thread of `run` owns the last one.
+    Worker& getOwnWorker(void) noexcept
+    {
+        return this->workers[this->pool != nullptr ? this->pool->getCurrentWorker() : 0];
+    }
+
+    //  @brief      Gets the out-degree of the vertex of a given id, counting its edges if the graph does not cache it.
+    template <typename Graph>
+    static size_t getOutDegree(const Graph& graph, const VertexId_t id)
+    {
+        if constexpr (requires { graph.getOutDegree(id); })
+            return graph.getOutDegree(id);
+        else
+        {
+            size_t degree = 0;
+            graph.forEachNeighbor(id, [&degree](const VertexId_t, const size_t) { ++degree; });
+            return degree;
+        }
+    }
+
+    //  @brief      Empties the worker states, and returns the total number of vertices and edges of the next frontier.
+    std::pair<size_t, size_t> collectCounters(void) noexcept
+    {
+        size_t vertices = 0, edges = 0;
+        for (Worker& worker : this->workers)
+        {
+            vertices += std::exchange(worker.vertices, 0);
+            edges += std::exchange(worker.edges, 0);
+        }
+        return { vertices, edges };
+    }
+
+    /*
+        @brief      Expands the sparse frontier top-down: every frontier vertex claims its unvisited neighbors with an atomic bit set.
+        @returns    `std::pair<size_t, size_t>` The number of vertices of the next frontier, and the sum of their out-degrees.
+    */
+    template <typename Graph>
+    std::pair<size_t, size_t> stepTopDown(const Graph& graph, const std::uint32_t depth)
+    {
+        this->forEachIndex(this->frontier.size(), [&](const size_t index)
+            {
+                const VertexId_t vertex = this->frontier[index];
+                Worker& own = this->getOwnWorker();
+                graph.forEachNeighbor(vertex, [&](const VertexId_t neighbor, const size_t)
+                    {
+                        const std::uint64_t bit = std::uint64_t(1) << (neighbor % 64);
+                        std::atomic<std::uint64_t>& word = this->visited[neighbor / 64];
+                        if ((word.load(std::memory_order_relaxed) & bit) != 0 || (word.fetch_or(bit, std::memory_order_relaxed) & bit) != 0)
+                            return;
+                        this->depths[neighbor] = depth;
+                        this->parents[neighbor] = vertex;
+                        own.next.push_back(neighbor);
+                        own.edges += getOutDegree(graph, neighbor);
+                    });
+            });
+        this->frontier.clear();
+        for (Worker& worker : this->workers)
+        {
+            worker.vertices = worker.next.size();
+            this->frontier.insert(this->frontier.end(), worker.next.begin(), worker.next.end());
+            worker.next.clear();
+        }
+        return this->collectCounters();
+    }
+
+    /*
+        @brief      Expands the bitmap frontier bottom-up: every unvisited vertex takes its first predecessor in the frontier as its parent.
+        @returns    `std::pair<size_t, size_t>` The number of vertices of the next frontier, and the sum of their out-degrees.
+        @note       Every task owns whole bitmap words, so that visited bits and next frontier bits are written without atomics.
+    */
+    template <typename Graph>
+    std::pair<size_t, size_t> stepBottomUp(const Graph& graph, const std::uint32_t depth)
+    {
+        ++this->bottomUpSteps;
+        this->forEachIndex(this->wordCount, [&](const size_t wordIndex)
+            {
+                Worker& own = this->getOwnWorker();
+                const std::uint64_t visitedWord = this->visited[wordIndex].load(std::memory_order_relaxed);
+                std::uint64_t nextWord = 0;
+                const size_t first = wordIndex * 64, last = std::min<size_t>(first + 64, this->idBound);
+                for (size_t vertex = first; vertex < last; ++vertex)
+                {
+                    const std::uint64_t bit = std::uint64_t(1) << (vertex % 64);
+                    if ((visitedWord & bit) != 0 || !graph.containsVertex(static_cast<VertexId_t>(vertex)))
+                        continue;
+                    graph.forEachPredecessor(static_cast<VertexId_t>(vertex), [&](const VertexId_t predecessor, const size_t) -> bool
+                        {
+                            if ((this->frontierBits[predecessor / 64] & (std::uint64_t(1) << (predecessor % 64))) == 0)
+                                return true;
+                            this->depths[vertex] = depth;
+                            this->parents[vertex] = predecessor;
+                            nextWord |= bit;
+                            return false;
+                        });
+                    if ((nextWord & bit) != 0)
+                        own.edges += getOutDegree(graph, static_cast<VertexId_t>(vertex));
+                }
+                this->nextBits[wordIndex] = nextWord;
+                this->visited[wordIndex].store(visitedWord | nextWord, std::memory_order_relaxed);
+                own.vertices += static_cast<size_t>(std::popcount(nextWord));
+            });
+        this->frontierBits.swap(this->nextBits);
+        return this->collectCounters();
+    }
+
+    //  @brief      Converts the sparse frontier into a bitmap.
+    void toBitmap(void)
+    {
+        std::fill(this->frontierBits.begin(), this->frontierBits.begin() + this->wordCount, 0);
+        for (const VertexId_t vertex : this->frontier)
+            this->frontierBits[vertex / 64] |= std::uint64_t(1) << (vertex % 64);
+    }
+
+    //  @brief      Converts the bitmap frontier into a sparse frontier, in increasing id order.
+    void toSparse(void)
+    {
+        this->frontier.clear();
+        for (size_t wordIndex = 0; wordIndex < this->wordCount; ++wordIndex)
+            for (std::uint64_t word = this->frontierBits[wordIndex]; word != 0; word &= word - 1)
+                this->frontier.push_back(static_cast<VertexId_t>(wordIndex * 64 + std::countr_zero(word)));
+    }
+
+    //  @brief      Grows the arrays to a given id bound, and clears the visited set.
+    void prepare(const VertexId_t idBound)
+    {
+        this->idBound = idBound;
+        this->wordCount = (static_cast<size_t>(idBound) + 63) / 64;
+        if (this->wordCapacity < this->wordCount)
+        {
+            this->visited = std::make_unique<std::atomic<std::uint64_t>[]>(this->wordCount);
+            this->frontierBits.resize(this->wordCount);
+            this->nextBits.resize(this->wordCount);
+            this->wordCapacity = this->wordCount;
+        }
+        if (this->depths.size() < idBound)
+        {
+            this->depths.resize(idBound);
+            this->parents.resize(idBound);
+        }
+        for (size_t wordIndex = 0; wordIndex < this->wordCount; ++wordIndex)
+            this->visited[wordIndex].store(0, std::memory_order_relaxed);
+        this->workers = std::vector<Worker>(this->pool != nullptr ? this->pool->getThreadCount() + 1 : 1);
+        this->frontier.clear();
+        this->reachedCount = 0;
+        this->bottomUpSteps = 0;
+    }
+
+public:
+    /*
+        @brief      Runs a breadth-first search from a given starting vertex.
+        @param      graph The graph to be searched. It must provide `getOrder`, `getSize`, and must not be modified during the search.
+        @param      start The id of the starting vertex. It must exist in the graph.
+        @param      pool The thread pool on which the levels are expanded, or `nullptr` to expand them on the calling thread.
+    */
+    template <typename Graph>
+    void run(const Graph& graph, const VertexId_t start, ThreadPool* const pool = nullptr)
+    {
+        this->pool = pool;
+        this->prepare(graph.getIdBound());
+        this->visited[start / 64].store(std::uint64_t(1) << (start % 64), std::memory_order_relaxed);
+        this->depths[start] = 0;
+        this->parents[start] = start;
+        this->frontier.push_back(start);
+        size_t frontierVertices = 1, frontierEdges = getOutDegree(graph, start);
+        size_t unexploredEdges = graph.getSize() - frontierEdges;
+        const size_t order = graph.getOrder();
+        bool bottomUp = false;
+        for (std::uint32_t depth = 1; frontierVertices != 0; ++depth)
+        {
+            this->reachedCount += frontierVertices;
+            if constexpr (requires { graph.forEachPredecessor(start, [](const VertexId_t, const size_t) {}); })
+            {
+                if (!bottomUp && frontierEdges > unexploredEdges / ALPHA)
+                {
+                    this->toBitmap();
+                    bottomUp = true;
+                }
+                else if (bottomUp && frontierVertices < order / BETA)
+                {
+                    this->toSparse();
+                    bottomUp = false;
+                }
+                if (bottomUp)
+                    std::tie(frontierVertices, frontierEdges) = this->stepBottomUp(graph, depth);
+            }
+            if (!bottomUp)
+                std::tie(frontierVertices, frontierEdges) = this->stepTopDown(graph, depth);
+            unexploredEdges -= std::min(unexploredEdges, frontierEdges);
+        }
+        this->pool = nullptr;
+    }
+
+    /*
+        @brief      Checks whether a given vertex was reached by the last search.
+        @param      id The id of the vertex to be checked.
+        @returns    `true` if the given vertex was reached, `false` otherwise.
+    */
+    bool isReached(const VertexId_t id) const noexcept
+    {
+        return id < this->idBound && (this->visited[id / 64].load(std::memory_order_relaxed) & (std::uint64_t(1) << (id % 64))) != 0;
+    }
+
+    /*
+        @brief      Gets the depth of a given vertex in the BFS tree of the last search, i.e. its number of edges from the starting vertex.
+        @param      id The id of the vertex of which the depth is to be found.
+        @returns    `size_t` The depth of the given vertex, or `SIZE_MAX` if it was not reached.
+    */
+    size_t getDepth(const VertexId_t id) const noexcept
+    {
+        return this->isReached(id) ? this->depths[id] : SIZE_MAX;
+    }
+
+    /*
+        @brief      Gets the parent of a given reached vertex in the BFS tree of the last search.
+        @param      id The id of the reached vertex of which the parent is to be found.
+        @returns    `VertexId_t` The id of the parent, which is the starting vertex itself for the starting vertex.
+    */
+    VertexId_t getParent(const VertexId_t id) const noexcept
+    {
+        return this->parents[id];
+    }
+
+    /*
+        @brief      Gets the number of vertices reached by the last search, including the starting vertex.
+        @returns    `size_t` The number of reached vertices.
+    */
+    size_t getReachedCount(void) const noexcept
+    {
+        return this->reachedCount;
+    }
+
+    /*
+        @brief      Gets the number of levels expanded bottom-up by the last search.
+        @returns    `size_t` The number of bottom-up steps.
+    */
+    size_t getBottomUpStepCount(void) const noexcept
+    {
+        return this->bottomUpSteps;
+    }
+};
+
+/*
+    @brief      Gets the BFS engine owned by the calling thread, reused by all its searches.
+    @returns    `BfsEngine&` The engine of the calling thread.
+*/
+inline BfsEngine& getThreadLocalBfsEngine(void)
+{
+    static thread_local BfsEngine engine;
+    return engine;
+}
+
+#endif // __BFS_ENGINE_HPP_
@@ -0,0 +1,206 @@
+/*
+    @headerfile     BidirectionalDijkstraEngine.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines a reusable bidirectional Dijkstra engine for point-to-point shortest path queries.
+    @details        A forward search from the source and a backward search from the target, over the incoming edges, are alternated
+    @details        until the sum of their radii reaches the shortest source-to-target distance found so far.
+    @note           The graph must provide `forEachPredecessor`, see `GraphKernels.hpp`.
+    @note           An engine is not thread-safe: every thread must use its own, e.g. through `getThreadLocalBidirectionalDijkstraEngine()`.
+*/
+
+#ifndef __BIDIRECTIONAL_DIJKSTRA_ENGINE_HPP_
+#define __BIDIRECTIONAL_DIJKSTRA_ENGINE_HPP_
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include "GraphWDTypes.hpp"
+#include "GraphKernels.hpp"
+#include "PriorityQueues.hpp"
+
+/*
+    @class      BidirectionalDijkstraEngine
+    @brief      Solves point-to-point shortest path queries with a bidirectional Dijkstra search, with path reconstruction.
+    @tparam     Queue The min-priority queue of both searches, see `PriorityQueues.hpp`.
+*/
+template <typename Queue = IndexedDaryHeap<4>>
+class BidirectionalDijkstraEngine final
+{
+private:
+    //  @struct     Search
+    //  @brief      The state of the search in one direction. `parents` point towards the source (forward) or the target (backward).
+    struct Search
+    {
+        std::vector<size_t> distances;
+        std::vector<VertexId_t> parents;
+        std::vector<std::uint32_t> marks;
+        Queue queue;
+        size_t radius = 0;
+    };
+
+    std::array<Search, 2> searches;
+    std::uint32_t generation = 0;
+    size_t settledCount = 0;
+    size_t distance = SIZE_MAX;
+    VertexId_t meeting = 0;
+
+    //  @brief      Invalidates the results of the previous query, and grows the arrays to a given id bound.
+    void prepare(const VertexId_t idBound)
+    {
+        if (this->generation >= UINT32_MAX / 2 - 1)
+        {
+            for (Search& search : this->searches)
+                std::fill(search.marks.begin(), search.marks.end(), 0);
+            this->generation = 0;
+        }
+        ++this->generation;
+        for (Search& search : this->searches)
+        {
+            if (search.marks.size() < idBound)
+            {
+                search.distances.resize(idBound);
+                search.parents.resize(idBound);
+                search.marks.resize(idBound, 0);
+            }
+            search.queue.reset(idBound);
+            search.radius = 0;
+        }
+        this->settledCount = 0;
+        this->distance = SIZE_MAX;
+    }
+
+    /*
+        @brief      Settles the next vertex of the search in one direction, and relaxes its edges in that direction.
+        @param      graph The graph, or its reversed adapter for the backward search.
+        @param      self The search to be advanced.
+        @param      other The search in the opposite direction, with which meetings are detected.
+    */
+    template <typename Graph>
+    void step(const Graph& graph, Search& self, const Search& other)
+    {
+        const std::uint32_t reached = 2 * this->generation, done = reached + 1;
+        const auto [currentDistance, current] = self.queue.pop();
+        if (self.marks[current] == done || currentDistance > self.distances[current])
+            return;
+        self.marks[current] = done;
+        self.radius = currentDistance;
+        ++this->settledCount;
+        graph.forEachNeighbor(current, [&](const VertexId_t neighbor, const size_t weight)
+            {
+                const size_t newDistance = currentDistance + weight;
+                const std::uint32_t mark = self.marks[neighbor];
+                if (mark == done || (mark == reached && newDistance >= self.distances[neighbor]))
+                    return;
+                self.marks[neighbor] = reached;
+                self.distances[neighbor] = newDistance;
+                self.parents[neighbor] = current;
+                self.queue.push(neighbor, newDistance);
+                if (other.marks[neighbor] >= reached && newDistance + other.distances[neighbor] < this->distance)
+                {
+                    this->distance = newDistance + other.distances[neighbor];
+                    this->meeting = neighbor;
+                }
+            });
+    }
+
+public:
+    /*
+        @brief      Runs the bidirectional Dijkstra search from a given source vertex to a given target vertex.
+        @param      graph The graph in which the shortest path is computed.
+        @param      source The id of the source vertex. It must exist in the graph.
+        @param      target The id of the target vertex. It must exist in the graph.
+        @note       The search in the direction with the smaller queue is advanced first.
+    */
+    template <typename Graph>
+    void run(const Graph& graph, const VertexId_t source, const VertexId_t target)
+    {
+        this->prepare(graph.getIdBound());
+        auto& [forward, backward] = this->searches;
+        const std::uint32_t reached = 2 * this->generation;
+        forward.marks[source] = reached;
+        forward.distances[source] = 0;
+        forward.parents[source] = source;
+        backward.marks[target] = reached;
+        backward.distances[target] = 0;
+        backward.parents[target] = target;
+        if (source == target)
+        {
+            this->distance = 0;
+            this->meeting = source;
+            return;
+        }
+        forward.queue.push(source, 0);
+        backward.queue.push(target, 0);
+        const GraphKernels::ReverseGraph<Graph> reverse(graph);
+        while (!forward.queue.empty() && !backward.queue.empty())
+        {
+            if (this->distance != SIZE_MAX && forward.radius + backward.radius >= this->distance)
+                break;
+            if (forward.queue.size() <= backward.queue.size())
+                this->step(graph, forward, backward);
+            else
+                this->step(reverse, backward, forward);
+        }
+    }
+
+    /*
+        @brief      Gets the shortest distance from the source to the target of the last query.
+        @returns    `size_t` The shortest distance, or `SIZE_MAX` if the target is unreachable.
+    */
+    size_t getDistance(void) const noexcept
+    {
+        return this->distance;
+    }
+
+    /*
+        @brief      Reconstructs the shortest path from the source to the target of the last query.
+        @returns    `std::vector<VertexId_t>` The ids of the vertices on the path, from the source to the target,
+        @returns    or an empty vector if the target is unreachable.
+    */
+    std::vector<VertexId_t> getPath(void) const
+    {
+        std::vector<VertexId_t> path;
+        if (this->distance == SIZE_MAX)
+            return path;
+        const auto& [forward, backward] = this->searches;
+        VertexId_t vertex = this->meeting;
+        path.push_back(vertex);
+        while (forward.parents[vertex] != vertex)
+        {
+            vertex = forward.parents[vertex];
+            path.push_back(vertex);
+        }
+        std::reverse(path.begin(), path.end());
+        vertex = this->meeting;
+        while (backward.parents[vertex] != vertex)
+        {
+            vertex = backward.parents[vertex];
+            path.push_back(vertex);
+        }
+        return path;
+    }
+
+    /*
+        @brief      Gets the number of vertices settled by the last query, in both directions.
+        @returns    `size_t` The number of settled vertices.
+    */
+    size_t getSettledCount(void) const noexcept
+    {
+        return this->settledCount;
+    }
+};
+
+/*
+    @brief      Gets the bidirectional engine owned by the calling thread, reused by all its queries.
+    @returns    `BidirectionalDijkstraEngine<Queue>&` The engine of the calling thread.
+*/
+template <typename Queue = IndexedDaryHeap<4>>
+BidirectionalDijkstraEngine<Queue>& getThreadLocalBidirectionalDijkstraEngine(void)
+{
+    static thread_local BidirectionalDijkstraEngine<Queue> engine;
+    return engine;
+}
+
+#endif // __BIDIRECTIONAL_DIJKSTRA_ENGINE_HPP_
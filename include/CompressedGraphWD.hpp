@@ -0,0 +1,205 @@
+/*
+    @headerfile     CompressedGraphWD.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines an immutable snapshot of a `GraphWD` with compressed adjacency lists, for graphs too large for `GraphWDView`.
+    @details        Following WebGraph, the sorted neighbors of a vertex are gap-encoded: the first neighbor as its signed distance to the vertex,
+    @details        and every next one as its distance to the previous one minus one, so that the locality of the ids turns into small numbers.
+    @details        Gaps, degrees and weights are written as LEB128 varints, one byte per value below 128.
+    @details        Weights are stored relative to the smallest weight of the graph, and not at all if every weight is equal.
+    @details        The list of the vertex of id `i` starts at `blockOffsets[i / 64] + relativeOffsets[i]` in `bytes`, with its degree.
+    @note           A snapshot is obtained through `GraphWD::compress()`, and is unaffected by later modifications of the graph.
+*/
+
+#ifndef __COMPRESSED_GRAPH_WD_HPP_
+#define __COMPRESSED_GRAPH_WD_HPP_
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include "GraphWD.hpp"
+#include "GraphKernels.hpp"
+
+/*
+    @class      CompressedGraphWD
+    @brief      Stores a frozen weighted and directed graph with gap-encoded varint adjacency lists, decoded on the fly by the algorithms.
+    @details    Vertices keep the ids they have in the compressed graph. Names are stored as in `GraphWDView`, outside of the adjacency.
+    @note       An edge typically costs 2 bytes with small weights, and 1 byte with uniform weights, plus about 4 bytes per vertex of offsets.
+*/
+class CompressedGraphWD final
+{
+    friend GraphWD;
+
+private:
+    //  @brief      The binary logarithm of the number of vertices sharing a 64-bit offset into `bytes`.
+    static constexpr unsigned BLOCK_SHIFT = 6;
+
+    std::vector<std::uint64_t> nameOffsets;
+    std::vector<char> nameChars;
+    std::vector<VertexId_t> sortedIds;
+    std::vector<std::uint64_t> blockOffsets;
+    std::vector<std::uint32_t> relativeOffsets;
+    std::vector<std::uint8_t> bytes;
+    size_t edgeCount = 0;
+    size_t weightBase = 0;
+    bool isUniformlyWeighted = true;
+
+    CompressedGraphWD(void) = default;
+
+    //  @brief      Decodes the varint at a given cursor, and advances the cursor past it.
+    static std::uint64_t decodeVarint(const std::uint8_t*& cursor) noexcept
+    {
+        std::uint64_t value = *cursor++;
+        if (value < 0x80)
+            return value;
+        value &= 0x7F;
+        for (unsigned shift = 7;; shift += 7)
+        {
+            const std::uint64_t byte = *cursor++;
+            value |= (byte & 0x7F) << shift;
+            if (byte < 0x80)
+                return value;
+        }
+    }
+
+    //  @brief      Gets the start of the encoded list of the vertex of a given id, which begins with its degree.
+    const std::uint8_t* getList(const VertexId_t id) const noexcept
+    {
+        return this->bytes.data() + this->blockOffsets[id >> BLOCK_SHIFT] + this->relativeOffsets[id];
+    }
+
+    //  @brief      Gets the name of the vertex of a given id, without checking that it exists, empty for a removed id.
+    std::string_view getName(const VertexId_t id) const noexcept
+    {
+        return { this->nameChars.data() + this->nameOffsets[id], this->nameOffsets[id + 1] - this->nameOffsets[id] };
+    }
+
+    //  @brief      Gets the id of a given vertex, or `getIdBound()` if it does not exist in the snapshot.
+    VertexId_t findVertexId(const Vertex_t& vertex) const noexcept;
+
+    //  @brief      Gets the id of a given vertex, described by a given role in the error message.
+    VertexId_t getExistingId(const Vertex_t& vertex, const std::string& role) const;
+
+    //  @brief      Checks whether a vertex of a given id exists, described by a given role in the error message.
+    void validateId(const VertexId_t id, const std::string& role) const;
+
+    //  @brief      Maps given vertex ids to their respective vertex names.
+    std::vector<Vertex_t> getVertexNames(const std::vector<VertexId_t>& ids) const;
+
+public:
+    //  @brief      Gets the order (number of vertices) of the snapshot.
+    size_t getOrder(void) const noexcept;
+
+    //  @brief      Gets the size (number of edges) of the snapshot.
+    size_t getSize(void) const noexcept;
+
+    //  @brief      Gets the id bound of the snapshot, such that every vertex id in use is strictly less than it.
+    VertexId_t getIdBound(void) const noexcept;
+
+    /*
+        @brief      Gets the number of bytes of the adjacency of the snapshot: encoded lists and offsets, without the vertex names.
+        @returns    `size_t` The number of bytes, which divided by `getSize()` gives the cost of an edge.
+    */
+    size_t getAdjacencyBytes(void) const noexcept;
+
+    //  @brief      Checks whether a vertex of a given id exists in the snapshot.
+    bool containsVertex(const VertexId_t id) const noexcept;
+
+    /*
+        @brief      Gets the id of a given vertex, identical to its id in the compressed graph.
+        @throws     `std::runtime_error` If the given vertex does not exist in the snapshot.
+    */
+    VertexId_t getVertexId(const Vertex_t& vertex) const;
+
+    /*
+        @brief      Gets the vertex of a given id, pointing into the snapshot.
+        @throws     `std::runtime_error` If no vertex of the given id exists in the snapshot.
+    */
+    std::string_view getVertexName(const VertexId_t id) const;
+
+    /*
+        @brief      Gets the out-degree (number of outgoing edges) of a given vertex, decoded in constant time.
+        @throws     `std::runtime_error` If the given vertex does not exist in the snapshot.
+    */
+    size_t getOutDegree(const Vertex_t& vertex) const;
+
+    //  @brief      Id-based overload of `size_t CompressedGraphWD::getOutDegree(const Vertex_t& vertex) const`.
+    size_t getOutDegree(const VertexId_t id) const;
+
+    /*
+        @brief      Gets the depth-first search traversal of the snapshot given a starting vertex.
+        @returns    `std::vector<Vertex_t>` The traversal, identical to the one returned by `GraphWD::getDFS` on the compressed graph.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the snapshot.
+    */
+    std::vector<Vertex_t> getDFS(const Vertex_t& startingVertex) const;
+
+    //  @brief      Id-based overload of `std::vector<Vertex_t> CompressedGraphWD::getDFS(const Vertex_t& startingVertex) const`, returning vertex ids.
+    std::vector<VertexId_t> getDFS(const VertexId_t startingVertex) const;
+
+    /*
+        @brief      Gets the breadth-first search traversal of the snapshot given a starting vertex.
+        @returns    `std::vector<Vertex_t>` The traversal, identical to the one returned by `GraphWD::getBFS` on the compressed graph.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the snapshot.
+    */
+    std::vector<Vertex_t> getBFS(const Vertex_t& startingVertex) const;
+
+    //  @brief      Id-based overload of `std::vector<Vertex_t> CompressedGraphWD::getBFS(const Vertex_t& startingVertex) const`, returning vertex ids.
+    std::vector<VertexId_t> getBFS(const VertexId_t startingVertex) const;
+
+    /*
+        @brief      Gets the shortest path from a given source vertex to each of the other reachable vertices, using Dijkstra's shortest paths algorithm.
+        @returns    `std::map<Vertex_t, size_t>` The reachable vertices and their respective shortest distance from the source vertex.
+        @throws     `std::runtime_error` If the given source vertex does not exist in the snapshot.
+    */
+    std::map<Vertex_t, size_t> getDijkstraShortestPaths(const Vertex_t& source) const;
+
+    /*
+        @brief      Id-based overload of `std::map<Vertex_t, size_t> CompressedGraphWD::getDijkstraShortestPaths(const Vertex_t& source) const`.
+        @returns    `std::vector<size_t>` The shortest distances indexed by vertex id, `SIZE_MAX` for unreachable or non-existent vertices.
+    */
+    std::vector<size_t> getDijkstraShortestPaths(const VertexId_t source) const;
+
+    /*
+        @brief      Gets the shortest path from a given source vertex to a given target vertex, using Dijkstra's shortest paths algorithm.
+        @returns    `std::pair<size_t, std::vector<Vertex_t>>` `{distance, path}`, or `{SIZE_MAX, {}}` if the target vertex is unreachable.
+        @throws     `std::runtime_error` If either the given source vertex or the given target vertex does not exist in the snapshot.
+    */
+    std::pair<size_t, std::vector<Vertex_t>> getDijkstraShortestPath(const Vertex_t& source, const Vertex_t& target) const;
+
+    //  @brief      Id-based overload of `std::pair<size_t, std::vector<Vertex_t>> CompressedGraphWD::getDijkstraShortestPath(const Vertex_t& source, const Vertex_t& target) const`.
+    std::pair<size_t, std::vector<VertexId_t>> getDijkstraShortestPath(const VertexId_t source, const VertexId_t target) const;
+
+    /*
+        @brief      Gets the topological sort of the snapshot, using Kahn's topological sorting algorithm.
+        @returns    `std::pair<bool, std::vector<Vertex_t>>` `{true, sortedVertices}` if a topological sort exists, `{false, {}}` otherwise.
+    */
+    std::pair<bool, std::vector<Vertex_t>> getKahnTopologicalSort(void) const;
+
+    /*
+        @brief      Calls a given visitor on each outgoing edge of the vertex of a given id, in increasing neighbor id order, decoding its list.
+        @param      id The id of the vertex of which the outgoing edges are visited. It must exist in the snapshot.
+        @param      visitor The callable invoked as `visitor(neighborId, weight)` for each outgoing edge. If it returns `bool`, `false` stops the visit.
+    */
+    template <typename Visitor>
+    void forEachNeighbor(const VertexId_t id, Visitor&& visitor) const
+    {
+        const std::uint8_t* cursor = this->getList(id);
+        std::uint64_t degree = CompressedGraphWD::decodeVarint(cursor);
+        if (degree == 0)
+            return;
+        const std::uint64_t firstGap = CompressedGraphWD::decodeVarint(cursor);
+        VertexId_t neighbor = static_cast<VertexId_t>(static_cast<std::int64_t>(id) + ((firstGap & 1) != 0 ? -static_cast<std::int64_t>(firstGap >> 1) - 1 : static_cast<std::int64_t>(firstGap >> 1)));
+        while (true)
+        {
+            const size_t weight = this->isUniformlyWeighted ? this->weightBase : this->weightBase + CompressedGraphWD::decodeVarint(cursor);
+            if (!GraphKernels::visitEdge(visitor, neighbor, weight) || --degree == 0)
+                return;
+            neighbor += static_cast<VertexId_t>(CompressedGraphWD::decodeVarint(cursor) + 1);
+        }
+    }
+};
+
+#endif // __COMPRESSED_GRAPH_WD_HPP_
@@ -0,0 +1,173 @@
+/*
+    @headerfile     ConcurrentGraphWD.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines a `GraphWD` shared between concurrent readers and writers, with snapshot isolation (read-copy-update).
+    @details        Readers pin the published version of the graph, an immutable `GraphWD` on which every `const` method runs unchanged.
+    @details        Pinning is lock-free: a reader increments the pin count of the published version, then checks that it is still published,
+    @details        and retries otherwise, so that it only ever retries because a writer published a newer version meanwhile.
+    @details        Writers apply batches of mutations to an unpublished version, and publish it with a single atomic store.
+    @details        A version is only reused once it is unpublished and its pin count is observed to be zero: a reader pinning it later sees that
+    @details        it is no longer published, and unpins it without reading it. Versions are therefore never freed before the `ConcurrentGraphWD`.
+    @details        The previous version is brought up to date by replaying the last batch as soon as no reader pins it anymore, so that a batch
+    @details        costs O(batch) instead of a full copy of the graph. The graphs of older unpinned versions are released.
+*/
+
+#ifndef __CONCURRENT_GRAPH_WD_HPP_
+#define __CONCURRENT_GRAPH_WD_HPP_
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <utility>
+#include "GraphWD.hpp"
+
+/*
+    @class      ConcurrentGraphWD
+    @brief      Publishes successive immutable versions of a graph, read lock-free and written in batches.
+    @note       Writers are serialized with each other, but never wait for readers. A reader pinning a version keeps it alive,
+    @note       and only forces the next batch to copy the graph instead of replaying into the previous version.
+    @note       At most two versions more than the largest number of versions pinned at once are allocated.
+*/
+class ConcurrentGraphWD final
+{
+private:
+    //  @struct     Version
+    //  @brief      A version of the graph, with the number of snapshots pinning it, and its number, 0 if its graph is out of date.
+    struct Version
+    {
+        GraphWD graph;
+        std::atomic<size_t> pins{ 0 };
+        size_t number = 0;
+    };
+
+public:
+    /*
+        @class      Batch
+        @brief      Records mutations, applied in order and all-or-nothing by `ConcurrentGraphWD::apply`.
+    */
+    class Batch final
+    {
+    private:
+        friend class ConcurrentGraphWD;
+
+        //  @struct     Operation
+        //  @brief      A recorded mutation.
+        struct Operation
+        {
+            enum class Type
+            {
+                INSERT_VERTEX,
+                REMOVE_VERTEX,
+                INSERT_EDGE,
+                REMOVE_EDGE
+            } type;
+            Vertex_t source;
+            Vertex_t destination;
+            size_t weight;
+        };
+
+        std::vector<Operation> operations;
+
+        //  @brief      Applies the recorded mutations to a given graph, in order.
+        void applyTo(GraphWD& graph) const;
+
+    public:
+        //  @brief      Records `GraphWD::insertVertex(vertex)`.
+        Batch& insertVertex(const Vertex_t& vertex);
+
+        //  @brief      Records `GraphWD::removeVertex(vertex)`.
+        Batch& removeVertex(const Vertex_t& vertex);
+
+        //  @brief      Records `GraphWD::insertEdge(source, destination, weight)`.
+        Batch& insertEdge(const Vertex_t& source, const Vertex_t& destination, const size_t weight);
+
+        //  @brief      Records `GraphWD::removeEdge(source, destination)`.
+        Batch& removeEdge(const Vertex_t& source, const Vertex_t& destination);
+
+        //  @brief      Gets the number of recorded mutations.
+        size_t size(void) const noexcept;
+
+        //  @brief      Checks whether no mutation is recorded.
+        bool empty(void) const noexcept;
+
+        //  @brief      Forgets the recorded mutations.
+        void clear(void) noexcept;
+    };
+
+    /*
+        @class      Snapshot
+        @brief      Pins a version of the graph, which stays unchanged as long as a copy of the snapshot exists.
+        @note       Copying, moving and destroying a snapshot are lock-free. A snapshot must not outlive its `ConcurrentGraphWD`.
+    */
+    class Snapshot final
+    {
+    private:
+        friend class ConcurrentGraphWD;
+
+        Version* version = nullptr;
+
+        //  @brief      Adopts a pin already taken on a given version.
+        explicit Snapshot(Version* const version) noexcept;
+
+    public:
+        Snapshot(const Snapshot& other) noexcept;
+
+        Snapshot(Snapshot&& other) noexcept;
+
+        Snapshot& operator=(Snapshot other) noexcept;
+
+        //  @brief      Unpins the version, unless the snapshot was moved from.
+        ~Snapshot(void);
+
+        //  @brief      Gets the pinned graph. The snapshot must not have been moved from.
+        const GraphWD& operator*(void) const noexcept;
+
+        //  @brief      Gets the pinned graph. The snapshot must not have been moved from.
+        const GraphWD* operator->(void) const noexcept;
+
+        //  @brief      Checks whether two snapshots pin the same version.
+        bool operator==(const Snapshot& other) const noexcept;
+    };
+
+private:
+    std::atomic<Version*> published;
+    std::mutex writerMutex;
+    std::vector<std::unique_ptr<Version>> versions;
+    Batch lastBatch;
+
+public:
+    /*
+        @brief      Publishes a given graph as the first version.
+        @param      graph The initial graph.
+    */
+    explicit ConcurrentGraphWD(GraphWD graph = GraphWD());
+
+    //  @brief      Destroys every version. No snapshot may be left.
+    ~ConcurrentGraphWD(void) = default;
+
+    ConcurrentGraphWD(const ConcurrentGraphWD&) = delete;
+
+    ConcurrentGraphWD& operator=(const ConcurrentGraphWD&) = delete;
+
+    /*
+        @brief      Pins the latest published version of the graph.
+        @returns    `ConcurrentGraphWD::Snapshot` The version, unaffected by later batches, and pinned as long as a copy of the snapshot exists.
+        @note       Lock-free, and safe to call from any number of threads: it only retries while writers publish new versions.
+    */
+    Snapshot getSnapshot(void) const noexcept;
+
+    /*
+        @brief      Applies a given batch of mutations and publishes the resulting version.
+        @param      batch The mutations, applied in order.
+        @throws     `std::runtime_error` If a mutation of the batch fails, in which case no mutation of the batch is published.
+        @note       Concurrent calls are serialized. Snapshots pinned before the call keep seeing the previous version.
+        @note       The batch is applied to the previous version if no snapshot pins it, to an older unpinned version after copying
+        @note       the published graph into it, or to a new copy of the published graph otherwise.
+    */
+    void apply(const Batch& batch);
+};
+
+#endif // __CONCURRENT_GRAPH_WD_HPP_
@@ -0,0 +1,299 @@
+/*
+    @headerfile     DeltaSteppingEngine.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines a parallel single-source shortest paths engine using the delta-stepping algorithm.
+    @details        Vertices are grouped into buckets of width `delta` by tentative distance, and buckets are settled in increasing order.
+    @details        The vertices of a bucket are relaxed in parallel: first along light edges (`weight <= delta`), repeatedly until the bucket
+    @details        stays empty, then once along heavy edges (`weight > delta`). Distances are lowered with atomic compare-and-swap operations,
+    @details        and every worker thread pushes the vertices it relaxes into its own cyclic array of buckets.
+    @note           An engine is not thread-safe: every thread must use its own, e.g. through `getThreadLocalDeltaSteppingEngine()`.
+*/
+
+#ifndef __DELTA_STEPPING_ENGINE_HPP_
+#define __DELTA_STEPPING_ENGINE_HPP_
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include "GraphWDTypes.hpp"
+#include "ThreadPool.hpp"
+
+/*
+    @class      DeltaSteppingEngine
+    @brief      Solves single-source shortest paths queries with delta-stepping, optionally on a thread pool.
+    @note       The distances are identical to those of `DijkstraEngine`; only the order in which vertices are settled differs.
+*/
+class DeltaSteppingEngine final
+{
+private:
+    //  @brief      The number of consecutive buckets held by the cyclic array of a worker. Farther buckets go to its overflow heap.
+    static constexpr size_t WINDOW = 256;
+
+    //  @brief      The number of vertices relaxed by each task of the pool.
+    static constexpr size_t GRAIN = 256;
+
+    //  @struct     Buckets
+    //  @brief      The buckets owned by one worker thread, aligned to its own cache lines.
+    struct alignas(64) Buckets
+    {
+        std::array<std::vector<VertexId_t>, WINDOW> window;
+        std::vector<std::pair<size_t, VertexId_t>> overflow;
+    };
+
+    std::unique_ptr<std::atomic<size_t>[]> distances;
+    size_t capacity = 0;
+    VertexId_t idBound = 0;
+    std::vector<Buckets> buckets;
+    std::vector<VertexId_t> frontier;
+    std::vector<VertexId_t> bucketVertices;
+    std::vector<size_t> frontierMarks;
+    std::vector<size_t> bucketMarks;
+    size_t frontierRound = 0;
+    size_t bucketRound = 0;
+    size_t currentBucket = 0;
+    size_t delta = 1;
+    ThreadPool* pool = nullptr;
+
+    //  @brief      Calls a given function on every index in `[0, count)`, on the pool if any and if there is enough work.
+    template <typename Function>
+    void forEachIndex(const size_t count, const size_t grain, Function&& function)
+    {
+        if (this->pool != nullptr && count > grain)
+            this->pool->parallelFor(0, count, grain, function);
+        else
+            for (size_t index = 0; index < count; ++index)
+                function(index);
+    }
+
+    //  @brief      Gets the buckets of the calling thread. The calling thread of `run` owns the last ones.
+    Buckets& getOwnBuckets(void) noexcept
+    {
+        return this->buckets[this->pool != nullptr ? this->pool->getCurrentWorker() : 0];
+    }
+
+    //  @brief      Pushes a given vertex into a given bucket of the calling thread.
+    void push(const VertexId_t vertex, const size_t bucket)
+    {
+        Buckets& own = this->getOwnBuckets();
+        if (bucket < this->currentBucket + WINDOW)
+            own.window[bucket % WINDOW].push_back(vertex);
+        else
+        {
+            own.overflow.emplace_back(bucket, vertex);
+            std::push_heap(own.overflow.begin(), own.overflow.end(), std::greater<>());
+        }
+    }
+
+    //  @brief      Lowers the distance of a given vertex to a given distance if it is shorter, and pushes the vertex into its new bucket.
+    void relax(const VertexId_t vertex, const size_t newDistance)
+    {
+        std::atomic<size_t>& distance = this->distances[vertex];
+        size_t oldDistance = distance.load(std::memory_order_relaxed);
+        while (newDistance < oldDistance)
+            if (distance.compare_exchange_weak(oldDistance, newDistance, std::memory_order_relaxed))
+            {
+                this->push(vertex, newDistance / this->delta);
+                return;
+            }
+    }
+
+    //  @brief      Checks whether a given vertex still belongs to a given bucket, i.e. whether its entry is not stale.
+    bool isInBucket(const VertexId_t vertex, const size_t bucket) const noexcept
+    {
+        return this->distances[vertex].load(std::memory_order_relaxed) / this->delta == bucket;
+    }
+
+    /*
+        @brief      Moves to the smallest non-empty bucket, and moves the overflowing entries that now fit into the cyclic arrays.
+        @returns    `true` if a non-empty bucket was found, `false` if every bucket is empty.
+        @note       Every entry of the cyclic arrays lies in `[currentBucket, currentBucket + WINDOW)`, so slots never mix two buckets.
+    */
+    bool advance(void)
+    {
+        size_t next = SIZE_MAX, overflowMin = SIZE_MAX;
+        for (size_t bucket = this->currentBucket; bucket < this->currentBucket + WINDOW && next == SIZE_MAX; ++bucket)
+            for (const Buckets& worker : this->buckets)
+                if (!worker.window[bucket % WINDOW].empty())
+                {
+                    next = bucket;
+                    break;
+                }
+        for (const Buckets& worker : this->buckets)
+            if (!worker.overflow.empty())
+                overflowMin = std::min(overflowMin, worker.overflow.front().first);
+        this->currentBucket = std::min(next, overflowMin);
+        if (this->currentBucket == SIZE_MAX)
+            return false;
+        for (Buckets& worker : this->buckets)
+            while (!worker.overflow.empty() && worker.overflow.front().first < this->currentBucket + WINDOW)
+            {
+                std::pop_heap(worker.overflow.begin(), worker.overflow.end(), std::greater<>());
+                const auto [bucket, vertex] = worker.overflow.back();
+                worker.overflow.pop_back();
+                if (this->isInBucket(vertex, bucket))
+                    worker.window[bucket % WINDOW].push_back(vertex);
+            }
+        return true;
+    }
+
+    /*
+        @brief      Empties the current bucket of every worker into the frontier, dropping stale and duplicate entries.
+        @returns    `true` if the frontier is not empty, `false` otherwise.
+        @note       The vertices of the frontier are also recorded, once each, for the relaxation of their heavy edges.
+    */
+    bool gatherFrontier(void)
+    {
+        ++this->frontierRound;
+        this->frontier.clear();
+        for (Buckets& worker : this->buckets)
+        {
+            std::vector<VertexId_t>& slot = worker.window[this->currentBucket % WINDOW];
+            for (const VertexId_t vertex : slot)
+            {
+                if (this->frontierMarks[vertex] == this->frontierRound || !this->isInBucket(vertex, this->currentBucket))
+                    continue;
+                this->frontierMarks[vertex] = this->frontierRound;
+                this->frontier.push_back(vertex);
+                if (this->bucketMarks[vertex] != this->bucketRound)
+                {
+                    this->bucketMarks[vertex] = this->bucketRound;
+                    this->bucketVertices.push_back(vertex);
+                }
+            }
+            slot.clear();
+        }
+        return !this->frontier.empty();
+    }
+
+    //  @brief      Chooses a bucket width from the heaviest edge weight and the average out-degree of a given graph.
+    template <typename Graph>
+    size_t chooseDelta(const Graph& graph)
+    {
+        constexpr size_t CHUNK = 4096;
+        std::atomic<size_t> maxWeight = 0, edges = 0, vertices = 0;
+        this->forEachIndex((this->idBound + CHUNK - 1) / CHUNK, 1, [&](const size_t chunk)
+            {
+                size_t chunkMaxWeight = 0, chunkEdges = 0, chunkVertices = 0;
+                const VertexId_t last = static_cast<VertexId_t>(std::min<size_t>(this->idBound, (chunk + 1) * CHUNK));
+                for (VertexId_t vertex = static_cast<VertexId_t>(chunk * CHUNK); vertex < last; ++vertex)
+                {
+                    if (!graph.containsVertex(vertex))
+                        continue;
+                    ++chunkVertices;
+                    graph.forEachNeighbor(vertex, [&](const VertexId_t, const size_t weight)
+                        {
+                            chunkMaxWeight = std::max(chunkMaxWeight, weight);
+                            ++chunkEdges;
+                        });
+                }
+                size_t current = maxWeight.load(std::memory_order_relaxed);
+                while (chunkMaxWeight > current && !maxWeight.compare_exchange_weak(current, chunkMaxWeight, std::memory_order_relaxed));
+                edges.fetch_add(chunkEdges, std::memory_order_relaxed);
+                vertices.fetch_add(chunkVertices, std::memory_order_relaxed);
+            });
+        const size_t averageDegree = std::max<size_t>(1, edges / std::max<size_t>(1, vertices));
+        return std::max<size_t>(1, maxWeight / averageDegree);
+    }
+
+    //  @brief      Grows the arrays to the id bound of the last query, and resets the distances and the buckets.
+    void prepare(void)
+    {
+        if (this->capacity < this->idBound)
+        {
+            this->distances = std::make_unique<std::atomic<size_t>[]>(this->idBound);
+            this->capacity = this->idBound;
+            this->frontierMarks.assign(this->idBound, 0);
+            this->bucketMarks.assign(this->idBound, 0);
+            this->frontierRound = this->bucketRound = 0;
+        }
+        this->forEachIndex(this->idBound, 16 * GRAIN, [this](const size_t vertex)
+            {
+                this->distances[vertex].store(SIZE_MAX, std::memory_order_relaxed);
+            });
+        this->buckets = std::vector<Buckets>(this->pool != nullptr ? this->pool->getThreadCount() + 1 : 1);
+        this->currentBucket = 0;
+    }
+
+public:
+    /*
+        @brief      Runs the delta-stepping shortest paths algorithm from a given source vertex.
+        @param      graph The graph in which the shortest paths are computed. It must not be modified during the query.
+        @param      source The id of the source vertex. It must exist in the graph.
+        @param      delta The width of the buckets, or zero to choose it from the weights and the average out-degree of the graph.
+        @param      pool The thread pool on which the relaxations run, or `nullptr` to run them on the calling thread.
+        @note       A small width does little redundant work but has few vertices per bucket to share among threads; a large width the opposite.
+    */
+    template <typename Graph>
+    void run(const Graph& graph, const VertexId_t source, const size_t delta = 0, ThreadPool* const pool = nullptr)
+    {
+        this->pool = pool;
+        this->idBound = graph.getIdBound();
+        this->prepare();
+        this->delta = delta != 0 ? delta : this->chooseDelta(graph);
+        this->distances[source].store(0, std::memory_order_relaxed);
+        this->push(source, 0);
+        while (this->advance())
+        {
+            ++this->bucketRound;
+            this->bucketVertices.clear();
+            while (this->gatherFrontier())
+                this->forEachIndex(this->frontier.size(), GRAIN, [&](const size_t index)
+                    {
+                        const VertexId_t vertex = this->frontier[index];
+                        const size_t distance = this->distances[vertex].load(std::memory_order_relaxed);
+                        graph.forEachNeighbor(vertex, [&](const VertexId_t neighbor, const size_t weight)
+                            {
+                                if (weight <= this->delta)
+                                    this->relax(neighbor, distance + weight);
+                            });
+                    });
+            this->forEachIndex(this->bucketVertices.size(), GRAIN, [&](const size_t index)
+                {
+                    const VertexId_t vertex = this->bucketVertices[index];
+                    const size_t distance = this->distances[vertex].load(std::memory_order_relaxed);
+                    graph.forEachNeighbor(vertex, [&](const VertexId_t neighbor, const size_t weight)
+                        {
+                            if (weight > this->delta)
+                                this->relax(neighbor, distance + weight);
+                        });
+                });
+        }
+        this->pool = nullptr;
+    }
+
+    /*
+        @brief      Gets the bucket width used by the last query.
+        @returns    `size_t` The bucket width.
+    */
+    size_t getDelta(void) const noexcept
+    {
+        return this->delta;
+    }
+
+    /*
+        @brief      Gets the shortest distance from the source of the last query to a given vertex.
+        @param      id The id of the vertex of which the distance is to be found.
+        @returns    `size_t` The shortest distance to the given vertex, or `SIZE_MAX` if it is unreachable.
+    */
+    size_t getDistance(const VertexId_t id) const noexcept
+    {
+        return id < this->idBound ? this->distances[id].load(std::memory_order_relaxed) : SIZE_MAX;
+    }
+};
+
+/*
+    @brief      Gets the delta-stepping engine owned by the calling thread, reused by all its queries.
+    @returns    `DeltaSteppingEngine&` The engine of the calling thread.
+*/
+inline DeltaSteppingEngine& getThreadLocalDeltaSteppingEngine(void)
+{
+    static thread_local DeltaSteppingEngine engine;
+    return engine;
+}
+
+#endif // __DELTA_STEPPING_ENGINE_HPP_
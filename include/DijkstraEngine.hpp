@@ -0,0 +1,247 @@
+/*
+    @headerfile     DijkstraEngine.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines a reusable Dijkstra shortest paths engine, running on `GraphWD`, `GraphWDView` or any graph providing the
+    @brief          interface described in `GraphKernels.hpp`.
+    @details        An engine owns its distance, predecessor and queue arrays, and keeps them allocated between queries. Arrays are
+    @details        invalidated in constant time by bumping a generation counter, so that a query only pays for the vertices it reaches.
+    @note           An engine is not thread-safe: every thread must use its own, e.g. through `getThreadLocalDijkstraEngine()`.
+*/
+
+#ifndef __DIJKSTRA_ENGINE_HPP_
+#define __DIJKSTRA_ENGINE_HPP_
+
+#include <vector>
+#include <algorithm>
+#include "GraphWDTypes.hpp"
+#include "GraphWDStats.hpp"
+#include "PriorityQueues.hpp"
+
+/*
+    @class      DijkstraEngine
+    @brief      Solves single-source, single-target and target-set shortest paths queries, with predecessor tracking.
+    @tparam     Queue The min-priority queue of the engine, see `PriorityQueues.hpp`: `IndexedDaryHeap` by default, or `RadixHeap`, which
+    @tparam     only supports the monotone keys of `run` and of `runAStar` with a consistent heuristic.
+*/
+template <typename Queue = IndexedDaryHeap<4>>
+class DijkstraEngine final
+{
+private:
+    std::vector<size_t> distances;
+    std::vector<VertexId_t> predecessors;
+    std::vector<std::uint32_t> marks;
+    std::vector<VertexId_t> settled;
+    std::uint32_t generation = 0;
+    Queue queue;
+
+    //  @brief      Checks whether a given vertex was reached (settled or not) by the last query.
+    bool isReached(const VertexId_t id) const noexcept
+    {
+        return id < this->marks.size() && this->marks[id] >= 3 * this->generation;
+    }
+
+    /*
+        @brief      Invalidates the results of the previous query, and grows the arrays to a given id bound.
+        @note       Marks of the current generation `g` are `3g` (reached), `3g + 1` (settled) and `3g + 2` (target not yet settled).
+    */
+    void prepare(const VertexId_t idBound)
+    {
+        if (this->generation >= UINT32_MAX / 3 - 1)
+        {
+            std::fill(this->marks.begin(), this->marks.end(), 0);
+            this->generation = 0;
+        }
+        ++this->generation;
+        if (this->marks.size() < idBound)
+        {
+            this->distances.resize(idBound);
+            this->predecessors.resize(idBound);
+            this->marks.resize(idBound, 0);
+        }
+        this->settled.clear();
+        this->queue.reset(idBound);
+    }
+
+public:
+    /*
+        @brief      Runs Dijkstra's shortest paths algorithm from a given source vertex.
+        @param      graph The graph in which the shortest paths are computed.
+        @param      source The id of the source vertex. It must exist in the graph.
+        @param      targets The ids of the target vertices, which must exist in the graph. If empty, every reachable vertex is settled;
+        @param      otherwise, the search stops as soon as every target is settled.
+    */
+    template <typename Graph>
+    void run(const Graph& graph, const VertexId_t source, const std::vector<VertexId_t>& targets = {})
+    {
+        GRAPH_WD_STATS(GraphStats::Stats& stats = GraphStats::getCurrent();)
+        this->prepare(graph.getIdBound());
+        const std::uint32_t reached = 3 * this->generation, done = reached + 1, target = reached + 2;
+        size_t remainingTargets = 0;
+        for (const VertexId_t id : targets)
+            if (this->marks[id] != target)
+            {
+                this->marks[id] = target;
+                this->distances[id] = SIZE_MAX;
+                ++remainingTargets;
+            }
+        if (this->marks[source] != target)
+            this->marks[source] = reached;
+        this->distances[source] = 0;
+        this->predecessors[source] = source;
+        this->queue.push(source, 0);
+        GRAPH_WD_STATS(++stats.pushes; GraphStats::updatePeakFrontier(stats, 1);)
+        while (!this->queue.empty())
+        {
+            const auto [currentDistance, current] = this->queue.pop();
+            if (this->marks[current] == done || currentDistance > this->distances[current])
+            {
+                GRAPH_WD_STATS(++stats.stalePops;)
+                continue;
+            }
+            const bool isTarget = this->marks[current] == target;
+            this->marks[current] = done;
+            this->settled.push_back(current);
+            GRAPH_WD_STATS(++stats.settledVertices;)
+            if (isTarget && --remainingTargets == 0)
+                break;
+            graph.forEachNeighbor(current, [&](const VertexId_t neighbor, const size_t weight)
+                {
+                    GRAPH_WD_STATS(++stats.relaxedEdges;)
+                    const size_t newDistance = currentDistance + weight;
+                    const std::uint32_t mark = this->marks[neighbor];
+                    if (mark == done)
+                        return;
+                    if (mark < reached)
+                        this->marks[neighbor] = reached;
+                    else if (newDistance >= this->distances[neighbor])
+                        return;
+                    this->distances[neighbor] = newDistance;
+                    this->predecessors[neighbor] = current;
+                    this->queue.push(neighbor, newDistance);
+                    GRAPH_WD_STATS(++stats.pushes; GraphStats::updatePeakFrontier(stats, this->queue.size());)
+                });
+        }
+    }
+
+    /*
+        @brief      Runs the A* search algorithm from a given source vertex to a given target vertex.
+        @param      graph The graph in which the shortest path is computed.
+        @param      source The id of the source vertex. It must exist in the graph.
+        @param      target The id of the target vertex. It must exist in the graph.
+        @param      heuristic The callable invoked as `heuristic(id)`, returning a lower bound of the distance from the given vertex to the target,
+        @param      or `SIZE_MAX` if the target is known to be unreachable from it. It must be consistent for the distance to be exact.
+    */
+    template <typename Graph, typename Heuristic>
+    void runAStar(const Graph& graph, const VertexId_t source, const VertexId_t target, Heuristic&& heuristic)
+    {
+        this->prepare(graph.getIdBound());
+        const std::uint32_t reached = 3 * this->generation, done = reached + 1;
+        const size_t sourceBound = heuristic(source);
+        if (sourceBound == SIZE_MAX)
+            return;
+        this->marks[source] = reached;
+        this->distances[source] = 0;
+        this->predecessors[source] = source;
+        this->queue.push(source, sourceBound);
+        while (!this->queue.empty())
+        {
+            const VertexId_t current = this->queue.pop().second;
+            if (this->marks[current] == done)
+                continue;
+            this->marks[current] = done;
+            this->settled.push_back(current);
+            if (current == target)
+                break;
+            const size_t currentDistance = this->distances[current];
+            graph.forEachNeighbor(current, [&](const VertexId_t neighbor, const size_t weight)
+                {
+                    const size_t newDistance = currentDistance + weight;
+                    const std::uint32_t mark = this->marks[neighbor];
+                    if (mark == done || (mark == reached && newDistance >= this->distances[neighbor]))
+                        return;
+                    const size_t bound = heuristic(neighbor);
+                    if (bound == SIZE_MAX)
+                        return;
+                    this->marks[neighbor] = reached;
+                    this->distances[neighbor] = newDistance;
+                    this->predecessors[neighbor] = current;
+                    this->queue.push(neighbor, newDistance + bound);
+                });
+        }
+    }
+
+    /*
+        @brief      Checks whether a given vertex was settled by the last query, i.e. whether its shortest distance is known.
+        @param      id The id of the vertex to be checked.
+        @returns    `true` if the given vertex was settled, `false` otherwise.
+    */
+    bool isSettled(const VertexId_t id) const noexcept
+    {
+        return this->isReached(id) && this->marks[id] == 3 * this->generation + 1;
+    }
+
+    /*
+        @brief      Gets the shortest distance from the source of the last query to a given vertex.
+        @param      id The id of the vertex of which the distance is to be found.
+        @returns    `size_t` The shortest distance to the given vertex, or `SIZE_MAX` if it was not settled.
+    */
+    size_t getDistance(const VertexId_t id) const noexcept
+    {
+        return this->isSettled(id) ? this->distances[id] : SIZE_MAX;
+    }
+
+    /*
+        @brief      Gets the predecessor of a given settled vertex on its shortest path from the source of the last query.
+        @param      id The id of the settled vertex of which the predecessor is to be found.
+        @returns    `VertexId_t` The id of the predecessor, which is the source itself for the source.
+    */
+    VertexId_t getPredecessor(const VertexId_t id) const noexcept
+    {
+        return this->predecessors[id];
+    }
+
+    /*
+        @brief      Reconstructs the shortest path from the source of the last query to a given vertex.
+        @param      id The id of the vertex to which the path leads.
+        @returns    `std::vector<VertexId_t>` The ids of the vertices on the path, from the source to the given vertex,
+        @returns    or an empty vector if the given vertex was not settled.
+    */
+    std::vector<VertexId_t> getPath(VertexId_t id) const
+    {
+        std::vector<VertexId_t> path;
+        if (!this->isSettled(id))
+            return path;
+        path.push_back(id);
+        while (this->predecessors[id] != id)
+        {
+            id = this->predecessors[id];
+            path.push_back(id);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    /*
+        @brief      Gets the vertices settled by the last query.
+        @returns    `const std::vector<VertexId_t>&` The ids of the settled vertices, in increasing distance order.
+    */
+    const std::vector<VertexId_t>& getSettled(void) const noexcept
+    {
+        return this->settled;
+    }
+};
+
+/*
+    @brief      Gets the engine owned by the calling thread, reused by all its queries.
+    @returns    `DijkstraEngine<Queue>&` The engine of the calling thread.
+*/
+template <typename Queue = IndexedDaryHeap<4>>
+DijkstraEngine<Queue>& getThreadLocalDijkstraEngine(void)
+{
+    static thread_local DijkstraEngine<Queue> engine;
+    return engine;
+}
+
+#endif // __DIJKSTRA_ENGINE_HPP_
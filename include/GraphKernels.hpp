@@ -0,0 +1,198 @@
+/*
+    @headerfile     GraphKernels.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the id-based algorithm kernels shared by `GraphWD`, `BasicGraphWD` and `GraphWDView`.
+    @details        A kernel runs on any graph type providing the following methods:
+    @details        `VertexId_t getIdBound(void) const`, one past the largest vertex id in use,
+    @details        `bool containsVertex(const VertexId_t id) const`, whether a vertex of the given id exists,
+    @details        `void forEachNeighbor(const VertexId_t id, Visitor visitor) const`, calling `visitor(neighborId, weight)` for each outgoing edge.
+    @details        A visitor returning `bool` stops the visit by returning `false`.
+    @details        Graphs indexing their incoming edges also provide `void forEachPredecessor(const VertexId_t id, Visitor visitor) const`,
+    @details        and can be searched backwards through `GraphKernels::ReverseGraph`.
+    @note           Kernels assume their vertex id arguments exist in the graph: validation is left to the callers.
+*/
+
+#ifndef __GRAPH_KERNELS_HPP_
+#define __GRAPH_KERNELS_HPP_
+
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include "GraphWDTypes.hpp"
+#include "GraphWDStats.hpp"
+
+namespace GraphKernels
+{
+    /*
+        @brief      Calls a given visitor on an edge, following the convention of the kernels.
+        @param      visitor The callable invoked as `visitor(id, weight)`.
+        @param      id The id of the vertex at the other end of the edge.
+        @param      weight The weight of the edge.
+        @returns    `bool` Whether the visit goes on, which is `false` only if the visitor returns `false`.
+    */
+    template <typename Visitor>
+    bool visitEdge(Visitor& visitor, const VertexId_t id, const size_t weight)
+    {
+        if constexpr (std::is_same_v<std::invoke_result_t<Visitor&, VertexId_t, size_t>, bool>)
+            return visitor(id, weight);
+        else
+        {
+            visitor(id, weight);
+            return true;
+        }
+    }
+
+    /*
+        @class      ReverseGraph
+        @brief      Adapts a graph indexing its incoming edges, so that kernels traverse its edges backwards.
+        @note       The adapted graph must outlive the adapter.
+    */
+    template <typename Graph>
+    class ReverseGraph final
+    {
+    private:
+        const Graph& graph;
+
+    public:
+        explicit ReverseGraph(const Graph& graph) noexcept : graph(graph) {}
+
+        VertexId_t getIdBound(void) const noexcept
+        {
+            return this->graph.getIdBound();
+        }
+
+        bool containsVertex(const VertexId_t id) const noexcept
+        {
+            return this->graph.containsVertex(id);
+        }
+
+        template <typename Visitor>
+        void forEachNeighbor(const VertexId_t id, Visitor&& visitor) const
+        {
+            this->graph.forEachPredecessor(id, visitor);
+        }
+
+        template <typename Visitor>
+        void forEachPredecessor(const VertexId_t id, Visitor&& visitor) const
+        {
+            this->graph.forEachNeighbor(id, visitor);
+        }
+    };
+
+    /*
+        @brief      Gets the depth-first search traversal of a graph given a starting vertex.
+        @param      graph The graph to be traversed.
+        @param      start The id of the vertex starting from which the depth-first search will begin.
+        @returns    `std::vector<VertexId_t>` The ids of the visited vertices, in depth-first search order.
+    */
+    template <typename Graph>
+    std::vector<VertexId_t> dfs(const Graph& graph, const VertexId_t start)
+    {
+        GRAPH_WD_STATS(GraphStats::Stats& stats = GraphStats::getCurrent();)
+        std::vector<VertexId_t> traversal;
+        std::vector<bool> visited(graph.getIdBound(), false);
+        visited[start] = true;
+        std::vector<VertexId_t> stack{ start };
+        GRAPH_WD_STATS(++stats.pushes; GraphStats::updatePeakFrontier(stats, 1);)
+        while (!stack.empty())
+        {
+            const VertexId_t vertex = stack.back();
+            stack.pop_back();
+            traversal.push_back(vertex);
+            GRAPH_WD_STATS(++stats.settledVertices;)
+            graph.forEachNeighbor(vertex, [&](const VertexId_t neighbor, const size_t)
+                {
+                    GRAPH_WD_STATS(++stats.relaxedEdges;)
+                    if (visited[neighbor])
+                        return;
+                    visited[neighbor] = true;
+                    stack.push_back(neighbor);
+                    GRAPH_WD_STATS(++stats.pushes; GraphStats::updatePeakFrontier(stats, stack.size());)
+                });
+        }
+        return traversal;
+    }
+
+    /*
+        @brief      Gets the breadth-first search traversal of a graph given a starting vertex.
+        @param      graph The graph to be traversed.
+        @param      start The id of the vertex starting from which the breadth-first search will begin.
+        @returns    `std::vector<VertexId_t>` The ids of the visited vertices, in breadth-first search order.
+    */
+    template <typename Graph>
+    std::vector<VertexId_t> bfs(const Graph& graph, const VertexId_t start)
+    {
+        GRAPH_WD_STATS(GraphStats::Stats& stats = GraphStats::getCurrent();)
+        std::vector<bool> visited(graph.getIdBound(), false);
+        visited[start] = true;
+        std::vector<VertexId_t> queue{ start };
+        GRAPH_WD_STATS(++stats.pushes; GraphStats::updatePeakFrontier(stats, 1);)
+        for (size_t head = 0; head < queue.size(); ++head)
+        {
+            GRAPH_WD_STATS(++stats.settledVertices;)
+            graph.forEachNeighbor(queue[head], [&](const VertexId_t neighbor, const size_t)
+                {
+                    GRAPH_WD_STATS(++stats.relaxedEdges;)
+                    if (visited[neighbor])
+                        return;
+                    visited[neighbor] = true;
+                    queue.push_back(neighbor);
+                    GRAPH_WD_STATS(++stats.pushes; GraphStats::updatePeakFrontier(stats, queue.size() - head - 1);)
+                });
+        }
+        return queue;
+    }
+
+    /*
+        @brief      Gets the topological sort of a graph, using Kahn's topological sorting algorithm.
+        @param      graph The graph to be sorted.
+        @returns    `std::pair<bool, std::vector<VertexId_t>>` `{true, sortedIds}` if a topological sort exists, `{false, {}}` otherwise.
+        @note       Sources are dequeued in increasing id order.
+        @note       In-degrees are read from `getInDegree(id)` when the graph caches them, and counted from the outgoing edges otherwise.
+    */
+    template <typename Graph>
+    std::pair<bool, std::vector<VertexId_t>> kahn(const Graph& graph)
+    {
+        std::vector<size_t> inDegrees(graph.getIdBound(), 0);
+        size_t order = 0;
+        for (VertexId_t vertex = 0; vertex < graph.getIdBound(); ++vertex)
+        {
+            if (!graph.containsVertex(vertex))
+                continue;
+            ++order;
+            if constexpr (requires { graph.getInDegree(vertex); })
+                inDegrees[vertex] = graph.getInDegree(vertex);
+            else
+                graph.forEachNeighbor(vertex, [&](const VertexId_t neighbor, const size_t)
+                    {
+                        ++inDegrees[neighbor];
+                    });
+        }
+        std::vector<VertexId_t> sources;
+        sources.reserve(order);
+        for (VertexId_t vertex = 0; vertex < graph.getIdBound(); ++vertex)
+            if (graph.containsVertex(vertex) && inDegrees[vertex] == 0)
+                sources.push_back(vertex);
+        GRAPH_WD_STATS(GraphStats::Stats& stats = GraphStats::getCurrent(); stats.pushes += sources.size(); GraphStats::updatePeakFrontier(stats, sources.size());)
+        for (size_t head = 0; head < sources.size(); ++head)
+        {
+            GRAPH_WD_STATS(++stats.settledVertices;)
+            graph.forEachNeighbor(sources[head], [&](const VertexId_t neighbor, const size_t)
+                {
+                    GRAPH_WD_STATS(++stats.relaxedEdges;)
+                    if (--inDegrees[neighbor] == 0)
+                    {
+                        sources.push_back(neighbor);
+                        GRAPH_WD_STATS(++stats.pushes; GraphStats::updatePeakFrontier(stats, sources.size() - head - 1);)
+                    }
+                });
+        }
+        if (sources.size() != order)
+            return { false, {} };
+        return { true, sources };
+    }
+}
+
+#endif // __GRAPH_KERNELS_HPP_
@@ -11,142 +11,384 @@
 #define __GRAPH_WD_HPP_
 
 #include <map>
+#include <limits>
+#include <memory>
 #include <string>
 #include <vector>
-#include <unordered_set>
+#include <iosfwd>
+#include <memory_resource>
+#include "GraphWDTypes.hpp"
+#include "GraphWDCore.hpp"
 
-// @typedef Vertex_t
-typedef std::string Vertex_t;
+class GraphWDView;
+class CompressedGraphWD;
+class LandmarkIndex;
+class ShortestPathCache;
+
+//  @brief      A weighted and directed graph of a given vertex type, weight type and storage policy, see `BasicGraphWD.hpp`.
+template <typename VertexT, typename WeightT = size_t, typename StoragePolicy = MapStorage>
+class BasicGraphWD;
+
+//  @typedef    GraphWD
+//  @brief      The graph of string vertices and `size_t` weights stored in ordered maps, specialized below with the full API of the library.
+typedef BasicGraphWD<Vertex_t, size_t, MapStorage> GraphWD;
 
 /*
     @class      GraphWD
     @brief      Defines a weighted and directed graph data structure containing neither negative weights nor self-loops nor duplicate edges.
+    @details    The vertices, the edges and the API shared with every `BasicGraphWD` are implemented by `GraphWDCore`, see `GraphWDCore.hpp`:
+    @details    vertices are interned to dense ids, incoming edges are indexed alongside outgoing ones, and edges are stored in ordered maps.
+    @details    This specialization adds the features of the library following the mutations of the graph: its version, the shortest path cache,
+    @details    the landmarks, the maintained topological order, and the snapshots, persistence and parallel algorithms.
+    @note       This is the specialization of `BasicGraphWD` named `GraphWD`: other vertex, weight and storage types use the generic template.
 */
-class GraphWD final
+template <>
+class BasicGraphWD<Vertex_t, size_t, MapStorage> final : public GraphWDCore<GraphWD, Vertex_t, size_t, MapStorage>
 {
+    friend class GraphWDCore<GraphWD, Vertex_t, size_t, MapStorage>;
+
+private:
+    typedef GraphWDCore<GraphWD, Vertex_t, size_t, MapStorage> Core;
+
+    size_t version = 0;
+    std::shared_ptr<const LandmarkIndex> landmarkIndex;
+    size_t landmarkVersion = 0;
+    bool maintainsTopologicalOrder = false;
+    std::vector<VertexId_t> topologicalOrder;
+    std::vector<size_t> topologicalIndices;
+    std::vector<bool> topologicalMarks;
+    size_t topologicalTombstones = 0;
+
+    //  @brief      Marks the position of a removed vertex in `topologicalOrder`, until the order is compacted.
+    static constexpr VertexId_t TOPOLOGICAL_TOMBSTONE = std::numeric_limits<VertexId_t>::max();
+
+    /*
+        @brief      Restores the maintained topological order before an edge is inserted, using the Pearce-Kelly algorithm.
+        @param      source The id of the source vertex of the edge.
+        @param      destination The id of the destination vertex of the edge.
+        @throws     `std::runtime_error` If the edge would close a cycle, in which case the order is left unchanged.
+        @note       Only the vertices ordered between the destination and the source, and connected to either of them, are searched and reordered.
+    */
+    void reorderForEdge(const VertexId_t source, const VertexId_t destination);
+
+    //  @brief      Removes the tombstones of the removed vertices from the maintained topological order, and renumbers the positions.
+    void compactTopologicalOrder(void) noexcept;
+
+    /*
+        @brief      Writes the graph to a given file in the binary format of `save`, without replacing it atomically.
+        @param      path The path of the file to be written.
+        @throws     `std::runtime_error` If the file cannot be written.
+    */
+    void writeFile(const std::string& path) const;
+
+    //  @brief      Appends an inserted vertex to the maintained topological order, and notifies the shortest path cache.
+    void onVertexInserted(const VertexId_t id);
+
+    //  @brief      Replaces a removed vertex by a tombstone in the maintained topological order, and notifies the shortest path cache.
+    void onVertexRemoved(const VertexId_t id);
+
+    //  @brief      Reorders the maintained topological order for an edge about to be inserted, rejecting the edges closing a cycle.
+    void onEdgeInserting(const VertexId_t source, const VertexId_t destination);
+
+    //  @brief      Notifies the shortest path cache of an inserted edge.
+    void onEdgeInserted(const VertexId_t source, const VertexId_t destination, const size_t weight);
+
+    //  @brief      Notifies the shortest path cache of a removed edge.
+    void onEdgeRemoved(const VertexId_t source, const VertexId_t destination);
+
+public:
+    //  @brief      The bulk builder of the graph, see `GraphWDBuilder.hpp`.
+    class Builder;
+
+    /*
+        @struct     CacheCounters
+        @brief      Describes the activity of the shortest path cache, see `setShortestPathCache`.
+        @details    `hits` and `misses` count the lookups of `getDijkstraShortestPaths`, `evictions` the trees dropped by the limits of the cache,
+        @details    and `invalidations` the trees dropped by mutations. `entries` and `bytes` measure the trees currently cached.
+    */
+    struct CacheCounters
+    {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t invalidations = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+    };
+
 private:
-    std::map<Vertex_t, std::map<Vertex_t, size_t>> adjacencyList;
+    //  @struct     ShortestPathCacheHandle
+    //  @brief      Owns the shortest path cache of the graph, if enabled. Copying a graph only copies the limits of its cache, not its trees.
+    struct ShortestPathCacheHandle
+    {
+        std::unique_ptr<ShortestPathCache> cache;
+
+        ShortestPathCacheHandle(void) noexcept;
+        ShortestPathCacheHandle(const ShortestPathCacheHandle& other);
+        ShortestPathCacheHandle(ShortestPathCacheHandle&& other) noexcept;
+        ShortestPathCacheHandle& operator=(const ShortestPathCacheHandle& other);
+        ShortestPathCacheHandle& operator=(ShortestPathCacheHandle&& other) noexcept;
+        ~ShortestPathCacheHandle();
+    };
+
+    ShortestPathCacheHandle shortestPathCache;
 
 public:
+    //  @brief      Creates an empty graph allocating from the default memory resource, `std::pmr::get_default_resource()`.
+    BasicGraphWD(void) = default;
+
+    /*
+        @brief      Creates an empty graph allocating its vertex and edge containers from a given memory resource.
+        @param      resource The memory resource, which must outlive the graph, and be thread-safe if the graph is mutated concurrently
+        @param      with other users of the resource.
+        @note       With a `std::pmr::unsynchronized_pool_resource`, building and destroying the graph, and removing vertices, recycle the
+        @note       edge nodes in the pool instead of calling `malloc` and `free` per edge. With a `std::pmr::monotonic_buffer_resource`,
+        @note       deallocations are free and the memory is released in bulk by the resource, which suits graphs built once.
+        @note       Vertex names longer than the small string buffer of `std::string` are still allocated by `std::string` itself.
+        @note       Following `std::pmr` containers, a copy of the graph allocates from the default memory resource, and a moved graph
+        @note       keeps the resource of its source.
+    */
+    explicit BasicGraphWD(std::pmr::memory_resource* const resource);
+
     //  @brief      Prints the adjacency list of the graph to the standard output.
     void printAdjacencyList(void) const noexcept;
 
     /*
-        @brief      Gets the order (number of vertices) of the graph.
-        @returns    `size_t` The order of the graph.
+        @brief      Gets the version of the graph, incremented by every insertion and deletion of a vertex or an edge.
+        @returns    `size_t` The version of the graph.
     */
-    size_t getOrder(void) const noexcept;
+    size_t getVersion(void) const noexcept;
 
     /*
-        @brief      Gets the size (number of edges) of the graph.
-        @returns    `size_t` The size of the graph.
+        @brief      Gets the shortest path from a given source vertex to each of the other reachable vertices, using Dijkstra's shortest paths algorithm.
+        @param      source The source vertex from which the shortest distances to each of the other reachable vertices is computed.
+        @returns    `std::map<Vertex_t, size_t>` The reachable vertices and their respective shortest distance from the source vertex.
+        @throws     `std::runtime_error` If the given source vertex does not exist in the graph.
+        @note       The tree of the source is read from, or stored into, the shortest path cache if it is enabled, see `setShortestPathCache`.
     */
-    size_t getSize(void) const noexcept;
+    std::map<Vertex_t, size_t> getDijkstraShortestPaths(const Vertex_t& source) const;
 
     /*
-        @brief      Gets the in-degree (number of incoming edges) of a given vertex.
-        @param      vertex The vertex of which the in-degree is to be computed.
-        @returns    `size_t` The in-degree of the given vertex.
-        @throws     `std::runtime_error` If the given vertex does not exist in the graph.
+        @brief      Id-based overload of `std::map<Vertex_t, size_t> GraphWD::getDijkstraShortestPaths(const Vertex_t& source) const`.
+        @returns    `std::vector<size_t>` The shortest distances indexed by vertex id, `SIZE_MAX` for unreachable or non-existent vertices.
     */
-    size_t getInDegree(const Vertex_t& vertex) const;
+    std::vector<size_t> getDijkstraShortestPaths(const VertexId_t source) const;
 
     /*
-        @brief      Gets the out-degree (number of outgoing edges) of a given vertex.
-        @param      vertex The vertex of which the out-degree is to be computed.
-        @returns    `size_t` The out-degree of the given vertex.
-        @throws     `std::runtime_error` If the given vertex does not exist in the graph.
+        @brief      Gets the shortest distances from a given source vertex to given target vertices, using Dijkstra's shortest paths algorithm.
+        @param      source The source vertex from which the shortest distances are computed.
+        @param      targets The target vertices to which the shortest distances are computed.
+        @returns    `std::map<Vertex_t, size_t>` The reachable target vertices and their respective shortest distance from the source vertex.
+        @throws     `std::runtime_error` If the given source vertex or any of the given target vertices does not exist in the graph.
+        @note       The search stops as soon as every target vertex is settled, and is skipped if the tree of the source is cached.
     */
-    size_t getOutDegree(const Vertex_t& vertex) const;
+    std::map<Vertex_t, size_t> getDijkstraShortestPaths(const Vertex_t& source, const std::vector<Vertex_t>& targets) const;
 
     /*
-        @brief      Inserts a given vertex into the graph.
-        @param      vertex The vertex to be inserted.
-        @throws     `std::runtime_error` If the given vertex is invalid or if it already exists in the graph.
-        @note       See also: `static bool GraphWD::isValidVertex(const Vertex_t& vertex) noexcept`.
+        @brief      Id-based overload of `std::map<Vertex_t, size_t> GraphWD::getDijkstraShortestPaths(const Vertex_t& source, const std::vector<Vertex_t>& targets) const`.
+        @returns    `std::vector<size_t>` The shortest distance to each given target, in the same order, `SIZE_MAX` for unreachable targets.
     */
-    void insertVertex(const Vertex_t& vertex);
+    std::vector<size_t> getDijkstraShortestPaths(const VertexId_t source, const std::vector<VertexId_t>& targets) const;
 
     /*
-        @brief      Removes a given vertex from the graph.
-        @param      vertex The vertex to be removed.
-        @throws     `std::runtime_error` If the given vertex does not exist in the graph.
+        @brief      Gets the shortest path from a given source vertex to each of the other reachable vertices, using the parallel delta-stepping algorithm.
+        @param      source The source vertex from which the shortest distances to each of the other reachable vertices is computed.
+        @param      delta The width of the distance buckets, or zero to choose it from the edge weights and the average out-degree.
+        @param      threads The number of worker threads, or zero for the number of hardware threads.
+        @returns    `std::map<Vertex_t, size_t>` The reachable vertices and their respective shortest distance from the source vertex.
+        @throws     `std::runtime_error` If the given source vertex does not exist in the graph.
+        @note       The distances are identical to those of `getDijkstraShortestPaths`. The graph must not be modified while the search runs.
     */
-    void removeVertex(const Vertex_t& vertex);
+    std::map<Vertex_t, size_t> getDeltaSteppingShortestPaths(const Vertex_t& source, const size_t delta, const unsigned threads) const;
 
     /*
-        @brief      Inserts a given edge to the graph.
-        @param      source The source vertex from which the edge will be inserted.
-        @param      destination The destination vertex to which the edge will be inserted.
-        @param      weight The non-negative weight of the edge to be inserted.
-        @throws     `std::runtime_error` If either the given source vertex or the given destination vertex does not exist in the graph,
-        @throws     or if an edge already exists between the given vertices, or if the given edge is a self-loop.
+        @brief      Id-based overload of `std::map<Vertex_t, size_t> GraphWD::getDeltaSteppingShortestPaths(const Vertex_t& source, const size_t delta, const unsigned threads) const`.
+        @returns    `std::vector<size_t>` The shortest distances indexed by vertex id, `SIZE_MAX` for unreachable or non-existent vertices.
     */
-    void insertEdge(const Vertex_t& source, const Vertex_t& destination, const size_t weight);
+    std::vector<size_t> getDeltaSteppingShortestPaths(const VertexId_t source, const size_t delta, const unsigned threads) const;
 
     /*
-        @brief      Removes a given edge from the graph.
-        @param      source The source vertex from which the edge will be removed.
-        @param      destination The destination vertex to which the edge will be removed.
-        @throws     `std::runtime_error` If either the given source vertex or the given destination vertex does not exist in the graph,
-        @throws     or if no edge exists between the given vertices.
+        @brief      Gets the shortest distances from each of given source vertices, running their Dijkstra searches concurrently on the shared thread pool.
+        @param      sources The source vertices from which the shortest distances are computed.
+        @param      threads The number of worker threads, or zero for the number of hardware threads.
+        @returns    `std::vector<std::map<Vertex_t, size_t>>` For each given source, in the same order, the reachable vertices and their shortest distance.
+        @throws     `std::runtime_error` If any of the given source vertices does not exist in the graph.
+        @note       The graph is only read, and must not be modified while the searches run.
     */
-    void removeEdge(const Vertex_t& source, const Vertex_t& destination);
+    std::vector<std::map<Vertex_t, size_t>> getShortestPathsBatch(const std::vector<Vertex_t>& sources, const unsigned threads) const;
 
     /*
-        @brief      Checks whether a given vertex is valid.
-        @param      vertex The vertex of which the validity is to be checked.
-        @returns    `true` if the given vertex is valid, `false` otherwise.
-        @note       A vertex is considered valid if and only if it is not empty, and all its characters are alphanumeric.
+        @brief      Id-based overload of `std::vector<std::map<Vertex_t, size_t>> GraphWD::getShortestPathsBatch(const std::vector<Vertex_t>& sources, const unsigned threads) const`.
+        @returns    `std::vector<std::vector<size_t>>` For each given source, the shortest distances indexed by vertex id, `SIZE_MAX` for unreachable or non-existent vertices.
     */
-    static bool isValidVertex(const Vertex_t& vertex) noexcept;
+    std::vector<std::vector<size_t>> getShortestPathsBatch(const std::vector<VertexId_t>& sources, const unsigned threads) const;
 
     /*
-        @brief      Checks whether the graph is connected given a starting vertex.
-        @param      startingVertex The vertex starting from which the graph is to be checked.
-        @returns    `true` if the graph is connected, `false` otherwise.
-        @throws     `std::runtime_error` If the given starting vertex does not exist in the graph.
-        @note       The graph is connected if and only if all vertices are reachable from the given starting vertex.
+        @brief      Gets the shortest distances between every pair of vertices, running one Dijkstra search per vertex on the shared thread pool.
+        @param      threads The number of worker threads, or zero for the number of hardware threads.
+        @returns    `std::vector<size_t>` The row-major `getIdBound() x getIdBound()` distance matrix, where `matrix[source * getIdBound() + target]`
+        @returns    is the shortest distance from `source` to `target`, `SIZE_MAX` for unreachable or non-existent vertices.
+        @throws     `std::runtime_error` If the matrix does not fit in memory.
+        @note       The matrix is quadratic in the number of vertices, and meant for small graphs.
     */
-    bool isConnected(const Vertex_t& startingVertex) const;
+    std::vector<size_t> getAllPairsShortestPaths(const unsigned threads) const;
 
     /*
-        @brief      Checks whether the graph is a tree.
-        @returns    `std::pair<bool, Vertex_t>` `{true, root}` if the graph is a tree, `{false, ""}` otherwise.
-        @note       The graph is a tree if and only if it is connected and the in-degree of every vertex is 1, except for one (inDegree(root) == 0).
+        @brief      Gets the shortest path from a given source vertex to a given target vertex, using an A* search guided by the landmarks (ALT).
+        @param      source The source vertex from which the shortest path starts.
+        @param      target The target vertex at which the shortest path ends.
+        @returns    `std::pair<size_t, std::vector<Vertex_t>>` `{distance, path}` where `path` lists the vertices from the source to the target,
+        @returns    or `{SIZE_MAX, {}}` if the target vertex is unreachable.
+        @throws     `std::runtime_error` If either the given source vertex or the given target vertex does not exist in the graph.
+        @note       If the landmarks are not up to date, the search is not guided, and settles as many vertices as `getDijkstraShortestPath`.
     */
-    std::pair<bool, Vertex_t> isTree(void) const noexcept;
+    std::pair<size_t, std::vector<Vertex_t>> getAStarShortestPath(const Vertex_t& source, const Vertex_t& target) const;
+
+    //  @brief      Id-based overload of `std::pair<size_t, std::vector<Vertex_t>> GraphWD::getAStarShortestPath(const Vertex_t& source, const Vertex_t& target) const`.
+    std::pair<size_t, std::vector<VertexId_t>> getAStarShortestPath(const VertexId_t source, const VertexId_t target) const;
 
     /*
-        @brief      Gets the depth-first search traversal of the graph given a starting vertex.
-        @param      startingVertex The vertex starting from which the depth-first search will begin.
-        @returns    `std::vector<Vertex_t>` The depth-first search traversal of the graph.
-        @throws     `std::runtime_error` If the given starting vertex does not exist in the graph.
+        @brief      Selects landmarks by farthest insertion, and builds their distance tables for `getAStarShortestPath`.
+        @param      count The maximum number of landmarks to be selected. Zero removes the landmarks.
+        @note       Building costs two Dijkstra searches per landmark, and `2 * count` distances of memory per vertex.
     */
-    std::vector<Vertex_t> getDFS(const Vertex_t& startingVertex) const;
+    void buildLandmarks(const size_t count);
 
     /*
-        @brief      Gets the breadth-first search traversal of the graph given a starting vertex.
-        @param      startingVertex The vertex starting from which the breadth-first search will begin.
-        @returns    `std::vector<Vertex_t>` The breadth-first search traversal of the graph.
-        @throws     `std::runtime_error` If the given starting vertex does not exist in the graph.
+        @brief      Sets the landmarks to given vertices, and builds their distance tables for `getAStarShortestPath`.
+        @param      landmarks The vertices to be used as landmarks.
+        @throws     `std::runtime_error` If any of the given vertices does not exist in the graph.
     */
-    std::vector<Vertex_t> getBFS(const Vertex_t& startingVertex) const;
+    void setLandmarks(const std::vector<Vertex_t>& landmarks);
+
+    //  @brief      Id-based overload of `void GraphWD::setLandmarks(const std::vector<Vertex_t>& landmarks)`.
+    void setLandmarks(const std::vector<VertexId_t>& landmarks);
 
     /*
-        @brief      Gets the shortest path from a given source vertex to each of the other reachable vertices, using Dijkstra's shortest paths algorithm.
-        @param      source The source vertex from which the shortest distances to each of the other reachable vertices is computed.
-        @returns    `std::map<Vertex_t, size_t>` The reachable vertices and their respective shortest distance from the source vertex.
-        @throws     `std::runtime_error` If the given source vertex does not exist in the graph.
+        @brief      Rebuilds the distance tables of the current landmarks, after the graph was modified.
+        @note       Landmarks which were removed from the graph are dropped.
     */
-    std::map<Vertex_t, size_t> getDijkstraShortestPaths(const Vertex_t& source) const;
+    void rebuildLandmarks(void);
+
+    /*
+        @brief      Gets the current landmarks.
+        @returns    `std::vector<Vertex_t>` The landmarks still existing in the graph, whether their tables are up to date or not.
+    */
+    std::vector<Vertex_t> getLandmarks(void) const;
 
     /*
-        @brief      Gets the topological sort of the graph, using Kahn's topological sorting algorithm.
-        @returns    `std::pair<bool, std::vector<Vertex_t>>` `{true, sortedVertices}` if a topological sort exists, `{false, {}}` otherwise.
-        @note       A topological sort of the graph exists if and only if the graph is acyclic.
+        @brief      Checks whether the landmark distance tables are up to date, i.e. whether the graph was not modified since they were built.
+        @returns    `true` if landmarks exist and are up to date, `false` otherwise.
     */
-    std::pair<bool, std::vector<Vertex_t>> getKahnTopologicalSort(void) const noexcept;
+    bool areLandmarksUpToDate(void) const noexcept;
+
+    /*
+        @brief      Starts or stops maintaining a topological order of the graph across insertions and removals.
+        @param      isEnabled Whether the order is maintained.
+        @throws     `std::runtime_error` If the order is enabled while the graph contains a cycle.
+        @note       While the order is maintained, `insertEdge` rejects every edge closing a cycle, and reorders only the affected vertices
+        @note       otherwise. Removals never invalidate the order: removing a vertex leaves a tombstone at its position, in constant time,
+        @note       and the tombstones are compacted once they outnumber the vertices, in amortized constant time per removal.
+    */
+    void setTopologicalOrderMaintenance(const bool isEnabled);
+
+    //  @brief      Checks whether a topological order of the graph is maintained, see `setTopologicalOrderMaintenance`.
+    bool isTopologicalOrderMaintained(void) const noexcept;
+
+    /*
+        @brief      Gets the maintained topological order of the graph, in linear time.
+        @returns    `std::vector<VertexId_t>` The ids of the vertices, each ordered before all its neighbors.
+        @throws     `std::runtime_error` If no topological order is maintained.
+    */
+    std::vector<VertexId_t> getTopologicalOrder(void) const;
+
+    /*
+        @brief      Gets the position of a given vertex in the maintained topological order, in constant time.
+        @param      vertex The vertex of which the position is to be found.
+        @returns    `size_t` The position of the vertex, increasing along `getTopologicalOrder()`: a vertex precedes another one
+        @returns    if and only if its position is smaller. Positions skip the tombstones of removed vertices until they are compacted.
+        @throws     `std::runtime_error` If no topological order is maintained, or if the given vertex does not exist in the graph.
+    */
+    size_t getTopologicalIndex(const Vertex_t& vertex) const;
+
+    //  @brief      Id-based overload of `size_t GraphWD::getTopologicalIndex(const Vertex_t& vertex) const`.
+    size_t getTopologicalIndex(const VertexId_t id) const;
+
+    /*
+        @brief      Enables the cache of the shortest path trees of `getDijkstraShortestPaths`, or changes its limits, dropping its trees.
+        @param      maxEntries The maximum number of cached trees, one per source vertex, or 0 to disable the cache.
+        @param      maxBytes The maximum number of bytes of the cached trees, beyond which the least recently used ones are evicted.
+        @note       A cached tree costs 12 bytes per vertex id. Mutations only drop the trees they can change: removing an edge drops the trees
+        @note       using it, inserting an edge drops the trees it shortens, and removing a vertex drops the trees reaching it.
+        @note       Lookups are thread-safe, so that const methods of the graph can still be called concurrently.
+    */
+    void setShortestPathCache(const size_t maxEntries, const size_t maxBytes);
+
+    //  @brief      Drops every tree of the shortest path cache, keeping its limits and counters.
+    void clearShortestPathCache(void);
+
+    //  @brief      Gets the counters of the shortest path cache, which are all zero if the cache is disabled.
+    CacheCounters getShortestPathCacheCounters(void) const;
+
+    /*
+        @brief      Freezes the graph into an immutable compressed-sparse-row snapshot.
+        @returns    `GraphWDView` The snapshot of the graph, on which read-only algorithms run without tree lookups or string comparisons.
+        @note       The snapshot is a copy: later modifications of the graph are not reflected in it.
+    */
+    GraphWDView freeze(void) const;
+
+    /*
+        @brief      Compresses the graph into an immutable snapshot with gap-encoded varint adjacency lists, for graphs too large for `freeze`.
+        @returns    `CompressedGraphWD` The snapshot of the graph, typically 4 to 6 bytes per edge including offsets, decoded on the fly by its algorithms.
+        @throws     `std::runtime_error` If the encoded lists of 64 consecutive vertex ids exceed 4 GiB.
+        @note       The snapshot is a copy: later modifications of the graph are not reflected in it.
+    */
+    CompressedGraphWD compress(void) const;
+
+    /*
+        @brief      Builds a graph from a text edge list read from a given stream, with the default policies of `GraphWD::Builder`.
+        @param      input The stream of `source destination weight` lines to be read until its end.
+        @returns    `GraphWD` The built graph, where self-loops and malformed lines are skipped, and duplicate edges keep their first weight.
+        @note       Use `GraphWD::Builder` directly to choose the policies, or to count the skipped lines.
+    */
+    static GraphWD loadEdgeList(std::istream& input);
+
+    /*
+        @brief      Builds a graph from a text edge list read from a given file, with the default policies of `GraphWD::Builder`.
+        @param      path The path of the file.
+        @returns    `GraphWD` The built graph.
+        @throws     `std::runtime_error` If the file cannot be opened.
+    */
+    static GraphWD loadEdgeList(const std::string& path);
+
+    /*
+        @brief      Saves the graph to a given file, in the versioned and checksummed binary format read by `openMapped`.
+        @param      path The path of the file to be written, replaced if it exists.
+        @throws     `std::runtime_error` If the file cannot be written, in which case an existing file is left untouched,
+        @throws     or if its directory cannot be synchronized after the file is replaced.
+        @note       The file holds a header, the vertex string table, and the compressed-sparse-row arrays of `freeze`.
+        @note       Integers are stored in the byte order of the machine, which is recorded in the header and checked when opening.
+        @note       The file is written under a temporary name in the same directory, synchronized, then renamed over the given path,
+        @note       and the directory is synchronized: processes and views mapping the replaced file keep reading its previous contents,
+        @note       and once `save` returns, the new file survives a crash.
+    */
+    void save(const std::string& path) const;
+
+    /*
+        @brief      Opens a graph saved by `save` as a read-only view running directly on the memory-mapped pages of the file.
+        @param      path The path of the file to be opened.
+        @param      verifyChecksum Whether the checksum of the whole file is verified, which reads every page once.
+        @returns    `GraphWDView` The view of the saved graph, keeping the file mapped until its last copy is destroyed.
+        @throws     `std::runtime_error` If the file cannot be read, is not a graph file, was written by another format version or byte order,
+        @throws     or if its checksum or structure does not match.
+        @note       With verification, the offsets, vertex ids and edge targets are also checked to be in bounds.
+        @note       Without verification, opening costs constant time regardless of the file size, and pages are loaded on first access:
+        @note       only the sizes of the sections and the totals of the offsets are checked, so the file must come from a trusted source.
+        @note       On platforms without `mmap`, the file is read into memory instead.
+    */
+    static GraphWDView openMapped(const std::string& path, const bool verifyChecksum = true);
 };
 
-#endif // __GRAPH_WD_HPP_
\ No newline at end of file
+extern template class GraphWDCore<GraphWD, Vertex_t, size_t, MapStorage>;
+
+#endif // __GRAPH_WD_HPP_
@@ -0,0 +1,181 @@
+/*
+    @headerfile     GraphWDBuilder.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the bulk builder of `GraphWD`, ingesting vertices and edges in batches and building the graph in one pass.
+    @details        Edges are appended without any tree lookup, then sorted (in parallel), deduplicated according to a policy,
+    @details        and inserted in increasing id order into the adjacency and incoming-edge indices. `MapStorage` hints these insertions at the end
+    @details        of each map, which skips the O(log(degree)) search, but every edge still allocates a tree node.
+    @details        Text edge lists are read in chunks, which are parsed in parallel; malformed lines are counted instead of aborting the load.
+*/
+
+#ifndef __GRAPH_WD_BUILDER_HPP_
+#define __GRAPH_WD_BUILDER_HPP_
+
+#include <string>
+#include <vector>
+#include <istream>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+#include "GraphWD.hpp"
+
+/*
+    @class      GraphWD::Builder
+    @brief      Collects vertices and edges, from calls or from text edge lists, and builds a `GraphWD` from them.
+    @details    An edge list has one record per line: `source destination weight` for an edge, or `vertex` alone for an isolated vertex,
+    @details    with fields separated by spaces or tabs. Empty lines, and lines starting with `#` or `%`, are ignored.
+    @note       Vertex ids are assigned in order of first appearance, so that they are identical across loads of the same input.
+*/
+class GraphWD::Builder final
+{
+public:
+    //  @enum       DuplicatePolicy
+    //  @brief      Resolves the edges inserted more than once between the same vertices.
+    enum class DuplicatePolicy
+    {
+        KEEP_FIRST,
+        KEEP_LAST,
+        KEEP_MINIMUM,
+        KEEP_MAXIMUM,
+        THROW
+    };
+
+    //  @enum       SelfLoopPolicy
+    //  @brief      Handles the edges from a vertex to itself, which the graph cannot contain.
+    enum class SelfLoopPolicy
+    {
+        SKIP,
+        THROW
+    };
+
+    //  @struct     Report
+    //  @brief      Counts what happened to the input of the builder.
+    struct Report
+    {
+        size_t lines = 0;
+        size_t rejectedLines = 0;
+        size_t selfLoops = 0;
+        size_t duplicates = 0;
+    };
+
+private:
+    //  @struct     Edge
+    //  @brief      An edge appended to the builder, before sorting and deduplication.
+    struct Edge
+    {
+        VertexId_t source;
+        VertexId_t destination;
+        size_t weight;
+    };
+
+    //  @struct     NameHash
+    //  @brief      Hashes vertex names, so that names parsed as `std::string_view` are looked up without allocating a string.
+    struct NameHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(const std::string_view name) const noexcept
+        {
+            return std::hash<std::string_view>()(name);
+        }
+    };
+
+    std::unordered_map<Vertex_t, VertexId_t, NameHash, std::equal_to<>> vertexIds;
+    std::vector<Vertex_t> vertexNames;
+    std::vector<Edge> edges;
+    DuplicatePolicy duplicatePolicy = DuplicatePolicy::KEEP_FIRST;
+    SelfLoopPolicy selfLoopPolicy = SelfLoopPolicy::SKIP;
+    unsigned threads = 0;
+    Report report;
+
+    /*
+        @brief      Gets the id of a given valid vertex name, interning it if it is new.
+        @param      vertex The name of the vertex.
+        @returns    `VertexId_t` The id of the vertex.
+    */
+    VertexId_t intern(const std::string_view vertex);
+
+    /*
+        @brief      Appends an edge between given interned vertices, applying the self-loop policy.
+        @throws     `std::runtime_error` If the edge is a self-loop and the self-loop policy is `THROW`.
+    */
+    void appendEdge(const VertexId_t source, const VertexId_t destination, const size_t weight);
+
+public:
+    /*
+        @brief      Sets the policy resolving duplicate edges. The default keeps the first inserted edge.
+        @param      policy The policy to be applied by `build`.
+        @returns    `Builder&` The builder itself, for chaining.
+    */
+    Builder& setDuplicatePolicy(const DuplicatePolicy policy) noexcept;
+
+    /*
+        @brief      Sets the policy handling self-loops. The default skips and counts them.
+        @param      policy The policy to be applied to the next edges.
+        @returns    `Builder&` The builder itself, for chaining.
+    */
+    Builder& setSelfLoopPolicy(const SelfLoopPolicy policy) noexcept;
+
+    /*
+        @brief      Sets the number of threads parsing edge lists and sorting edges.
+        @param      threads The number of worker threads, or zero for the number of hardware threads.
+        @returns    `Builder&` The builder itself, for chaining.
+    */
+    Builder& setThreads(const unsigned threads) noexcept;
+
+    /*
+        @brief      Adds a given vertex to the builder, unless it was already added.
+        @param      vertex The vertex to be added.
+        @returns    `VertexId_t` The id the vertex will have in the built graph.
+        @throws     `std::runtime_error` If the given vertex is invalid.
+    */
+    VertexId_t addVertex(const Vertex_t& vertex);
+
+    /*
+        @brief      Adds a given edge to the builder, and the vertices it connects if they were not added yet.
+        @param      source The source vertex of the edge.
+        @param      destination The destination vertex of the edge.
+        @param      weight The non-negative weight of the edge.
+        @throws     `std::runtime_error` If either vertex is invalid, or if the edge is a self-loop and the self-loop policy is `THROW`.
+    */
+    void addEdge(const Vertex_t& source, const Vertex_t& destination, const size_t weight);
+
+    //  @brief      Id-based overload of `void GraphWD::Builder::addEdge(const Vertex_t& source, const Vertex_t& destination, const size_t weight)`, for ids returned by `addVertex`.
+    void addEdge(const VertexId_t source, const VertexId_t destination, const size_t weight);
+
+    /*
+        @brief      Reads a text edge list from a given stream, chunk by chunk, parsing the chunks in parallel.
+        @param      input The stream to be read until its end.
+        @returns    `Builder&` The builder itself, for chaining.
+        @throws     `std::runtime_error` If an edge is a self-loop and the self-loop policy is `THROW`.
+        @note       Malformed lines, invalid vertices and negative, non-numeric or out-of-range weights are counted in `Report::rejectedLines` and skipped.
+    */
+    Builder& loadEdgeList(std::istream& input);
+
+    /*
+        @brief      Reads a text edge list from a given file.
+        @param      path The path of the file.
+        @returns    `Builder&` The builder itself, for chaining.
+        @throws     `std::runtime_error` If the file cannot be opened, or if an edge is a self-loop and the self-loop policy is `THROW`.
+    */
+    Builder& loadEdgeList(const std::string& path);
+
+    /*
+        @brief      Gets the counters of the input added since the builder was created.
+        @returns    `const Report&` The counters. `Report::duplicates` is only known after `build`.
+    */
+    const Report& getReport(void) const noexcept;
+
+    /*
+        @brief      Builds the graph from the added vertices and edges, and empties the builder, keeping its policies and its report.
+        @param      resource The memory resource of the built graph, see `GraphWD(std::pmr::memory_resource*)`.
+        @returns    `GraphWD` The built graph.
+        @throws     `std::runtime_error` If duplicate edges exist and the duplicate policy is `THROW`, in which case the builder keeps
+        @throws     its vertices and edges: it can still be built once the policy is changed.
+    */
+    GraphWD build(std::pmr::memory_resource* const resource = std::pmr::get_default_resource());
+};
+
+#endif // __GRAPH_WD_BUILDER_HPP_
@@ -0,0 +1,985 @@
+/*
+    @headerfile     GraphWDCore.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines `GraphWDCore`, the common base of `GraphWD` and of the generic `BasicGraphWD`, storing their vertices and edges.
+    @details        The core owns the interning of the vertices and the incoming and outgoing edges, stored by the storage policy, and implements
+    @details        every validation, error message and mutation, together with the algorithms shared by all graphs.
+    @details        A derived graph adds its own features, and follows the mutations through hooks, called on the derived graph once validated:
+    @details        - `onEdgeInserting(source, destination)` before an edge is inserted, which may throw to reject it;
+    @details        - `onVertexInserted(id)`, `onVertexRemoved(id)`, `onEdgeInserted(source, destination, weight)` and `onEdgeRemoved(source, destination)`
+    @details          after the mutation. The hooks of the core do nothing.
+*/
+
+#ifndef __GRAPH_WD_CORE_HPP_
+#define __GRAPH_WD_CORE_HPP_
+
+#include <map>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <memory_resource>
+#include "GraphWDTypes.hpp"
+#include "GraphWDStats.hpp"
+#include "GraphKernels.hpp"
+#include "StoragePolicies.hpp"
+#include "DijkstraEngine.hpp"
+#include "BidirectionalDijkstraEngine.hpp"
+#include "BfsEngine.hpp"
+#include "TraversalRanges.hpp"
+#include "TextColors.hpp"
+
+/*
+    @class      GraphWDCore
+    @brief      Stores a weighted and directed graph containing neither self-loops nor duplicate edges, and implements its common API.
+    @tparam     Derived The graph deriving from the core, of which the hooks are called and the traversal ranges are returned.
+    @tparam     VertexT The type of the vertices, integral or hashable.
+    @tparam     WeightT The unsigned integral type of the weights.
+    @tparam     StoragePolicy The storage of the edges, see `StoragePolicies.hpp`.
+    @details    Integral vertices are their own ids: they are neither hashed nor interned. Other vertices are interned to dense ids of type
+    @details    `VertexId_t` when inserted, and every method taking vertices then has an id-based overload for callers keeping the ids.
+    @details    Incoming edges are indexed alongside outgoing ones, so that in-degrees and vertex removals cost O(degree) instead of a full graph sweep.
+    @note       The id of a removed interned vertex is reused by later insertions.
+    @note       Vertex and edge containers allocate from a `std::pmr::memory_resource`, given to the constructor of the derived graph.
+*/
+template <typename Derived, typename VertexT, typename WeightT, typename StoragePolicy>
+class GraphWDCore
+{
+    static_assert(std::is_integral_v<WeightT> && std::is_unsigned_v<WeightT> && !std::is_same_v<WeightT, bool>, "Weights must be of an unsigned integral type.");
+
+public:
+    //  @brief      Whether vertices are interned to ids, which is the case for non-integral vertices.
+    static constexpr bool IS_INTERNING = !std::is_integral_v<VertexT>;
+
+    //  @typedef    DistanceMap_t
+    //  @brief      The distances returned by the vertex-based shortest paths methods: indexed by vertex for integral vertices, mapped otherwise.
+    typedef std::conditional_t<IS_INTERNING, std::map<VertexT, size_t>, std::vector<size_t>> DistanceMap_t;
+
+    //  @typedef    BfsTree_t
+    //  @brief      The trees returned by the vertex-based `getBFSTree`: `{depth, parent}` mapped by vertex for interned vertices,
+    //  @brief      and the depths and the parents indexed by vertex otherwise.
+    typedef std::conditional_t<IS_INTERNING, std::map<VertexT, std::pair<size_t, VertexT>>, std::pair<std::vector<size_t>, std::vector<VertexId_t>>> BfsTree_t;
+
+    //  @typedef    VertexName_t
+    //  @brief      The vertex returned by `getVertexName`: a reference to the interned vertex, or the integral vertex itself.
+    typedef std::conditional_t<IS_INTERNING, const VertexT&, VertexT> VertexName_t;
+
+    //  @typedef    Stats
+    //  @brief      Describes the work done by a call to an instrumented method, see `setStatsSink` and `GraphWDStats.hpp`.
+    typedef GraphStats::Stats Stats;
+
+    //  @typedef    StatsSink
+    //  @brief      The callable receiving the statistics of every successful call to an instrumented method.
+    typedef GraphStats::Sink StatsSink;
+
+private:
+    //  @struct     NoInterning
+    //  @brief      Replaces the interning structures of integral vertices, at no cost.
+    struct NoInterning
+    {
+        NoInterning(void) noexcept = default;
+
+        explicit NoInterning(std::pmr::memory_resource* const) noexcept {}
+    };
+
+protected:
+    typedef typename StoragePolicy::template Adjacency<WeightT> Adjacency_t;
+
+    [[no_unique_address]] std::conditional_t<IS_INTERNING, std::pmr::unordered_map<VertexT, VertexId_t>, NoInterning> vertexIds;
+    [[no_unique_address]] std::conditional_t<IS_INTERNING, std::pmr::vector<VertexT>, NoInterning> vertexNames;
+    std::vector<VertexId_t> freeIds;
+    std::pmr::vector<bool> isPresent;
+    Adjacency_t outgoing;
+    Adjacency_t incoming;
+    size_t order = 0;
+    size_t edgeCount = 0;
+    StatsSink statsSink;
+
+    //  @brief      Creates an empty graph allocating from the default memory resource, `std::pmr::get_default_resource()`.
+    GraphWDCore(void) = default;
+
+    //  @brief      Creates an empty graph allocating its vertex and edge containers from a given memory resource, which must outlive the graph.
+    explicit GraphWDCore(std::pmr::memory_resource* const resource)
+        : vertexIds(resource), vertexNames(resource), isPresent(resource), outgoing(resource), incoming(resource)
+    {
+    }
+
+    //  @brief      Describes a given vertex in error messages.
+    static std::string describe(const VertexT& vertex)
+    {
+        if constexpr (std::is_integral_v<VertexT>)
+            return std::to_string(vertex);
+        else if constexpr (std::is_convertible_v<const VertexT&, std::string>)
+            return vertex;
+        else
+            return "<vertex>";
+    }
+
+    //  @brief      Checks whether a vertex of a given id exists.
+    bool containsId(const VertexId_t id) const noexcept
+    {
+        return id < this->isPresent.size() && this->isPresent[id];
+    }
+
+    //  @brief      Gets the id of a given vertex, or `getIdBound()` if it does not exist in the graph.
+    VertexId_t findId(const VertexT& vertex) const noexcept
+    {
+        if constexpr (IS_INTERNING)
+        {
+            const auto itVertex = this->vertexIds.find(vertex);
+            return itVertex != this->vertexIds.end() ? itVertex->second : this->getIdBound();
+        }
+        else
+            return GraphWDCore::isValidVertex(vertex) && this->containsId(static_cast<VertexId_t>(vertex)) ? static_cast<VertexId_t>(vertex) : this->getIdBound();
+    }
+
+    //  @brief      Gets the id of a given vertex, described by a given role in the error message.
+    VertexId_t getExistingId(const VertexT& vertex, const char* const role) const
+    {
+        const VertexId_t id = this->findId(vertex);
+        if (id == this->getIdBound())
+            throw std::runtime_error(RED_BOLD + std::string(role) + " `" + GraphWDCore::describe(vertex) + "` does not exist in the graph.\n" DEFAULT_COLOR);
+        return id;
+    }
+
+    //  @brief      Checks whether a vertex of a given id exists, described by a given role in the error message.
+    void validateId(const VertexId_t id, const char* const role) const
+    {
+        if (!this->containsId(id))
+            throw std::runtime_error(RED_BOLD + std::string(role) + " id `" + std::to_string(id) + "` does not exist in the graph.\n" DEFAULT_COLOR);
+    }
+
+    //  @brief      Gets the vertex of a given id, which must exist in the graph.
+    VertexName_t getName(const VertexId_t id) const noexcept
+    {
+        if constexpr (IS_INTERNING)
+            return this->vertexNames[id];
+        else
+            return static_cast<VertexT>(id);
+    }
+
+    //  @brief      Maps given vertex ids to their respective vertices.
+    std::vector<VertexT> getVertexNames(const std::vector<VertexId_t>& ids) const
+    {
+        std::vector<VertexT> names;
+        names.reserve(ids.size());
+        for (const VertexId_t id : ids)
+            names.push_back(this->getName(id));
+        return names;
+    }
+
+    //  @brief      Called after a vertex of a given id is inserted.
+    void onVertexInserted(const VertexId_t) {}
+
+    //  @brief      Called after the vertex of a given id and its edges are removed.
+    void onVertexRemoved(const VertexId_t) {}
+
+    //  @brief      Called before an edge is inserted between the vertices of given ids, which exist and differ. Throwing rejects the edge.
+    void onEdgeInserting(const VertexId_t, const VertexId_t) {}
+
+    //  @brief      Called after an edge of a given weight is inserted between the vertices of given ids.
+    void onEdgeInserted(const VertexId_t, const VertexId_t, const WeightT) {}
+
+    //  @brief      Called after the edge between the vertices of given ids is removed.
+    void onEdgeRemoved(const VertexId_t, const VertexId_t) {}
+
+private:
+    Derived& derived(void) noexcept
+    {
+        return static_cast<Derived&>(*this);
+    }
+
+    const Derived& derived(void) const noexcept
+    {
+        return static_cast<const Derived&>(*this);
+    }
+
+    //  @brief      Removes the vertex of a given id, which must exist, and its incoming and outgoing edges.
+    void eraseVertex(const VertexId_t id)
+    {
+        this->outgoing.forEach(id, [&](const VertexId_t neighbor, const WeightT)
+            {
+                this->incoming.erase(neighbor, id);
+            });
+        this->incoming.forEach(id, [&](const VertexId_t predecessor, const WeightT)
+            {
+                this->outgoing.erase(predecessor, id);
+            });
+        this->edgeCount -= this->outgoing.getDegree(id) + this->incoming.getDegree(id);
+        GRAPH_WD_STATS(GraphStats::getCurrent().relaxedEdges += this->outgoing.getDegree(id) + this->incoming.getDegree(id);)
+        this->outgoing.clear(id);
+        this->incoming.clear(id);
+        this->isPresent[id] = false;
+        --this->order;
+        if constexpr (IS_INTERNING)
+        {
+            this->vertexIds.erase(this->vertexNames[id]);
+            this->vertexNames[id] = VertexT();
+            this->freeIds.push_back(id);
+        }
+        this->derived().onVertexRemoved(id);
+    }
+
+    //  @brief      Inserts an edge of a given weight between the vertices of given ids, which must exist.
+    void addEdge(const VertexId_t source, const VertexId_t destination, const WeightT weight)
+    {
+        if (source == destination)
+            throw std::runtime_error(RED_BOLD "Self loops are not allowed.\n" DEFAULT_COLOR);
+        this->derived().onEdgeInserting(source, destination);
+        if (!this->outgoing.insert(source, destination, weight))
+            throw std::runtime_error(RED_BOLD "An edge already exists from vertex `" + GraphWDCore::describe(this->getName(source)) + "` to vertex `" + GraphWDCore::describe(this->getName(destination)) + "`.\n" DEFAULT_COLOR);
+        this->incoming.insert(destination, source, weight);
+        ++this->edgeCount;
+        GRAPH_WD_STATS(++GraphStats::getCurrent().relaxedEdges;)
+        this->derived().onEdgeInserted(source, destination, weight);
+    }
+
+    //  @brief      Removes the edge between the vertices of given ids, which must exist.
+    void eraseEdge(const VertexId_t source, const VertexId_t destination)
+    {
+        if (!this->outgoing.erase(source, destination))
+            throw std::runtime_error(RED_BOLD "No edge exists from `" + GraphWDCore::describe(this->getName(source)) + "` to `" + GraphWDCore::describe(this->getName(destination)) + "`.\n" DEFAULT_COLOR);
+        this->incoming.erase(destination, source);
+        --this->edgeCount;
+        GRAPH_WD_STATS(++GraphStats::getCurrent().relaxedEdges;)
+        this->derived().onEdgeRemoved(source, destination);
+    }
+
+    //  @brief      Gets the weight of the edge between the vertices of given ids, which must exist.
+    WeightT findWeight(const VertexId_t source, const VertexId_t destination) const
+    {
+        const WeightT* const weight = this->outgoing.find(source, destination);
+        if (weight == nullptr)
+            throw std::runtime_error(RED_BOLD "No edge exists from `" + GraphWDCore::describe(this->getName(source)) + "` to `" + GraphWDCore::describe(this->getName(destination)) + "`.\n" DEFAULT_COLOR);
+        return *weight;
+    }
+
+    //  @brief      Checks whether every vertex is reachable from the vertex of a given id, which must exist.
+    bool isReachingAll(const VertexId_t start) const
+    {
+        auto& engine = getThreadLocalBfsEngine();
+        engine.run(*this, start, ThreadPool::getShared(this->getSize() >= BfsEngine::PARALLEL_MIN_EDGES ? 0 : 1));
+        return engine.getReachedCount() == this->getOrder();
+    }
+
+    //  @brief      Gets the depths and the parents of the breadth-first search tree rooted at the vertex of a given id, which must exist.
+    std::pair<std::vector<size_t>, std::vector<VertexId_t>> getTree(const VertexId_t start, const unsigned threads) const
+    {
+        auto& engine = getThreadLocalBfsEngine();
+        engine.run(*this, start, ThreadPool::getShared(threads != 0 || this->getSize() >= BfsEngine::PARALLEL_MIN_EDGES ? threads : 1));
+        std::vector<size_t> depths(this->getIdBound(), SIZE_MAX);
+        std::vector<VertexId_t> parents(this->getIdBound(), this->getIdBound());
+        for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
+            if (engine.isReached(vertex))
+            {
+                depths[vertex] = engine.getDepth(vertex);
+                parents[vertex] = engine.getParent(vertex);
+            }
+        return { depths, parents };
+    }
+
+    //  @brief      Gets the shortest distances from the vertex of a given id, which must exist, indexed by vertex id.
+    std::vector<size_t> getDistances(const VertexId_t source) const
+    {
+        auto& engine = getThreadLocalDijkstraEngine();
+        engine.run(*this, source);
+        std::vector<size_t> minDistances(this->getIdBound(), SIZE_MAX);
+        for (const VertexId_t vertex : engine.getSettled())
+            minDistances[vertex] = engine.getDistance(vertex);
+        return minDistances;
+    }
+
+    //  @brief      Gets the shortest distances from the vertex of a given id to the vertices of given ids, in the same order.
+    std::vector<size_t> getDistances(const VertexId_t source, const std::vector<VertexId_t>& targets) const
+    {
+        auto& engine = getThreadLocalDijkstraEngine();
+        engine.run(*this, source, targets);
+        std::vector<size_t> minDistances;
+        minDistances.reserve(targets.size());
+        for (const VertexId_t target : targets)
+            minDistances.push_back(engine.getDistance(target));
+        return minDistances;
+    }
+
+    //  @brief      Gets the shortest path between the vertices of given ids, which must exist.
+    std::pair<size_t, std::vector<VertexId_t>> getPath(const VertexId_t source, const VertexId_t target) const
+    {
+        auto& engine = getThreadLocalDijkstraEngine();
+        engine.run(*this, source, { target });
+        return { engine.getDistance(target), engine.getPath(target) };
+    }
+
+    //  @brief      Gets the shortest path between the vertices of given ids, which must exist, using a bidirectional search.
+    std::pair<size_t, std::vector<VertexId_t>> getBidirectionalPath(const VertexId_t source, const VertexId_t target) const
+    {
+        auto& engine = getThreadLocalBidirectionalDijkstraEngine();
+        engine.run(*this, source, target);
+        return { engine.getDistance(), engine.getPath() };
+    }
+
+public:
+    /*
+        @brief      Checks whether a given vertex can be inserted into a graph.
+        @param      vertex The vertex of which the validity is to be checked.
+        @returns    `true` if the given vertex is valid, `false` otherwise.
+        @note       Integral vertices are valid if and only if they lie in `[0, UINT32_MAX)`, and string vertices if and only if they are not empty
+        @note       and all their characters are alphanumeric. Vertices of other types are always valid.
+    */
+    static bool isValidVertex(const VertexT& vertex) noexcept
+    {
+        if constexpr (std::is_integral_v<VertexT>)
+        {
+            if constexpr (std::is_signed_v<VertexT>)
+                if (vertex < 0)
+                    return false;
+            return static_cast<std::make_unsigned_t<VertexT>>(vertex) < UINT32_MAX;
+        }
+        else if constexpr (std::is_same_v<VertexT, std::string>)
+        {
+            if (vertex.empty())
+                return false;
+            for (const char character : vertex)
+                if (!std::isalnum(static_cast<unsigned char>(character)))
+                    return false;
+            return true;
+        }
+        else
+            return true;
+    }
+
+    /*
+        @brief      Sets the sink receiving the statistics of `getDijkstraShortestPaths`, `getDFS`, `getBFS`, `getKahnTopologicalSort`,
+        @brief      and of the insertions and removals of vertices and edges.
+        @param      sink The sink, called on the calling thread once per successful call, or an empty function to disable reporting.
+        @note       Statistics are only recorded when the library is compiled with `GRAPH_WD_ENABLE_STATS` defined, which must then be defined
+        @note       consistently for every translation unit. Otherwise, the instrumentation is compiled out and the sink is never called.
+        @note       The sink must not throw, and must be thread-safe if const methods of the graph are called concurrently.
+        @note       Allocations are counted by the memory resource of the graph, if it is a `GraphStats::CountingResource`.
+    */
+    void setStatsSink(StatsSink sink)
+    {
+        this->statsSink = std::move(sink);
+    }
+
+    //  @brief      Gets the memory resource from which the graph allocates its vertex and edge containers.
+    std::pmr::memory_resource* getMemoryResource(void) const noexcept
+    {
+        return this->isPresent.get_allocator().resource();
+    }
+
+    /*
+        @brief      Gets the order (number of vertices) of the graph.
+        @returns    `size_t` The order of the graph.
+    */
+    size_t getOrder(void) const noexcept
+    {
+        return this->order;
+    }
+
+    /*
+        @brief      Gets the size (number of edges) of the graph.
+        @returns    `size_t` The size of the graph.
+        @note       The size is cached, and updated by every insertion and deletion.
+    */
+    size_t getSize(void) const noexcept
+    {
+        return this->edgeCount;
+    }
+
+    /*
+        @brief      Gets the id bound of the graph, such that every vertex id in use is strictly less than it.
+        @returns    `VertexId_t` The id bound of the graph, suitable for sizing arrays indexed by vertex id.
+    */
+    VertexId_t getIdBound(void) const noexcept
+    {
+        return static_cast<VertexId_t>(this->isPresent.size());
+    }
+
+    /*
+        @brief      Checks whether a given vertex exists in the graph.
+        @param      vertex The vertex of which the existence is to be checked.
+        @returns    `true` if the given vertex exists in the graph, `false` otherwise.
+    */
+    bool containsVertex(const VertexT& vertex) const noexcept
+    {
+        return this->findId(vertex) != this->getIdBound();
+    }
+
+    //  @brief      Id-based overload of `containsVertex`, for interned vertices.
+    bool containsVertex(const VertexId_t id) const noexcept requires IS_INTERNING
+    {
+        return this->containsId(id);
+    }
+
+    /*
+        @brief      Gets the id of a given vertex, which is the vertex itself for integral vertices.
+        @param      vertex The vertex of which the id is to be found.
+        @returns    `VertexId_t` The id of the given vertex.
+        @throws     `std::runtime_error` If the given vertex does not exist in the graph.
+    */
+    VertexId_t getVertexId(const VertexT& vertex) const
+    {
+        return this->getExistingId(vertex, "Vertex");
+    }
+
+    /*
+        @brief      Gets the vertex of a given id.
+        @param      id The id of which the vertex is to be found.
+        @returns    `VertexName_t` The vertex of the given id.
+        @throws     `std::runtime_error` If no vertex of the given id exists in the graph.
+    */
+    VertexName_t getVertexName(const VertexId_t id) const
+    {
+        this->validateId(id, "Vertex");
+        return this->getName(id);
+    }
+
+    /*
+        @brief      Gets the in-degree (number of incoming edges) of a given vertex.
+        @param      vertex The vertex of which the in-degree is to be computed.
+        @returns    `size_t` The in-degree of the given vertex.
+        @throws     `std::runtime_error` If the given vertex does not exist in the graph.
+        @note       The in-degree is read from the incoming-edge index.
+    */
+    size_t getInDegree(const VertexT& vertex) const
+    {
+        return this->incoming.getDegree(this->getExistingId(vertex, "Vertex"));
+    }
+
+    //  @brief      Id-based overload of `getInDegree`, for interned vertices.
+    size_t getInDegree(const VertexId_t id) const requires IS_INTERNING
+    {
+        this->validateId(id, "Vertex");
+        return this->incoming.getDegree(id);
+    }
+
+    /*
+        @brief      Gets the out-degree (number of outgoing edges) of a given vertex.
+        @param      vertex The vertex of which the out-degree is to be computed.
+        @returns    `size_t` The out-degree of the given vertex.
+        @throws     `std::runtime_error` If the given vertex does not exist in the graph.
+    */
+    size_t getOutDegree(const VertexT& vertex) const
+    {
+        return this->outgoing.getDegree(this->getExistingId(vertex, "Vertex"));
+    }
+
+    //  @brief      Id-based overload of `getOutDegree`, for interned vertices.
+    size_t getOutDegree(const VertexId_t id) const requires IS_INTERNING
+    {
+        this->validateId(id, "Vertex");
+        return this->outgoing.getDegree(id);
+    }
+
+    /*
+        @brief      Inserts a given vertex into the graph.
+        @param      vertex The vertex to be inserted.
+        @returns    `VertexId_t` The id assigned to the inserted vertex.
+        @throws     `std::runtime_error` If the given vertex is invalid or if it already exists in the graph.
+        @note       Integral vertices extend the id bound up to themselves. See also `isValidVertex`.
+        @note       Provides the strong exception guarantee: if anything throws, including the `onVertexInserted` hook, the graph is unchanged.
+    */
+    VertexId_t insertVertex(const VertexT& vertex)
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "insertVertex", this->getMemoryResource());)
+        if (!GraphWDCore::isValidVertex(vertex))
+            throw std::runtime_error(RED_BOLD "Vertex `" + GraphWDCore::describe(vertex) + "` is not valid.\n" DEFAULT_COLOR);
+        VertexId_t id;
+        if constexpr (IS_INTERNING)
+        {
+            if (this->vertexIds.contains(vertex))
+                throw std::runtime_error(RED_BOLD "Vertex `" + GraphWDCore::describe(vertex) + "` already exists in the graph.\n" DEFAULT_COLOR);
+            id = this->freeIds.empty() ? this->getIdBound() : this->freeIds.back();
+        }
+        else
+        {
+            id = static_cast<VertexId_t>(vertex);
+            if (this->containsId(id))
+                throw std::runtime_error(RED_BOLD "Vertex `" + GraphWDCore::describe(vertex) + "` already exists in the graph.\n" DEFAULT_COLOR);
+        }
+        //  Allocates before changing the graph, and undoes the interning if the hook throws, so that a failed insertion changes nothing.
+        //  Extra empty adjacency lists past the id bound are not observable.
+        const VertexId_t idBound = this->getIdBound();
+        if (id >= idBound)
+        {
+            this->outgoing.resize(id + 1);
+            this->incoming.resize(id + 1);
+            this->isPresent.reserve(size_t(id) + 1);
+        }
+        if constexpr (IS_INTERNING)
+        {
+            if (id == idBound)
+                this->vertexNames.push_back(vertex);
+            else
+                this->vertexNames[id] = vertex;
+            try
+            {
+                this->vertexIds.try_emplace(vertex, id);
+            }
+            catch (...)
+            {
+                if (id == idBound)
+                    this->vertexNames.pop_back();
+                else
+                    this->vertexNames[id] = VertexT();
+                throw;
+            }
+        }
+        if (id >= idBound)
+            this->isPresent.resize(size_t(id) + 1, false);
+        this->isPresent[id] = true;
+        ++this->order;
+        try
+        {
+            this->derived().onVertexInserted(id);
+        }
+        catch (...)
+        {
+            this->isPresent[id] = false;
+            --this->order;
+            if (id >= idBound)
+                this->isPresent.resize(idBound);
+            if constexpr (IS_INTERNING)
+            {
+                this->vertexIds.erase(vertex);
+                if (id == idBound)
+                    this->vertexNames.pop_back();
+                else
+                    this->vertexNames[id] = VertexT();
+            }
+            throw;
+        }
+        if constexpr (IS_INTERNING)
+            if (id != idBound)
+                this->freeIds.pop_back();
+        return id;
+    }
+
+    /*
+        @brief      Removes a given vertex from the graph.
+        @param      vertex The vertex to be removed.
+        @throws     `std::runtime_error` If the given vertex does not exist in the graph.
+        @note       Only the incoming and outgoing edges of the given vertex are visited.
+    */
+    void removeVertex(const VertexT& vertex)
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "removeVertex", this->getMemoryResource());)
+        this->eraseVertex(this->getExistingId(vertex, "Vertex"));
+    }
+
+    //  @brief      Id-based overload of `removeVertex`, for interned vertices.
+    void removeVertex(const VertexId_t id) requires IS_INTERNING
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "removeVertex", this->getMemoryResource());)
+        this->validateId(id, "Vertex");
+        this->eraseVertex(id);
+    }
+
+    /*
+        @brief      Inserts a given edge to the graph.
+        @param      source The source vertex from which the edge will be inserted.
+        @param      destination The destination vertex to which the edge will be inserted.
+        @param      weight The weight of the edge to be inserted.
+        @throws     `std::runtime_error` If either the given source vertex or the given destination vertex does not exist in the graph,
+        @throws     or if an edge already exists between the given vertices, or if the given edge is a self-loop.
+    */
+    void insertEdge(const VertexT& source, const VertexT& destination, const WeightT weight)
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "insertEdge", this->getMemoryResource());)
+        const VertexId_t sourceId = this->getExistingId(source, "Source vertex");
+        this->addEdge(sourceId, this->getExistingId(destination, "Destination vertex"), weight);
+    }
+
+    //  @brief      Id-based overload of `insertEdge`, for interned vertices.
+    void insertEdge(const VertexId_t source, const VertexId_t destination, const WeightT weight) requires IS_INTERNING
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "insertEdge", this->getMemoryResource());)
+        this->validateId(source, "Source vertex");
+        this->validateId(destination, "Destination vertex");
+        this->addEdge(source, destination, weight);
+    }
+
+    /*
+        @brief      Removes a given edge from the graph.
+        @param      source The source vertex from which the edge will be removed.
+        @param      destination The destination vertex to which the edge will be removed.
+        @throws     `std::runtime_error` If either the given source vertex or the given destination vertex does not exist in the graph,
+        @throws     or if no edge exists between the given vertices.
+    */
+    void removeEdge(const VertexT& source, const VertexT& destination)
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "removeEdge", this->getMemoryResource());)
+        const VertexId_t sourceId = this->getExistingId(source, "Source vertex");
+        this->eraseEdge(sourceId, this->getExistingId(destination, "Destination vertex"));
+    }
+
+    //  @brief      Id-based overload of `removeEdge`, for interned vertices.
+    void removeEdge(const VertexId_t source, const VertexId_t destination) requires IS_INTERNING
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "removeEdge", this->getMemoryResource());)
+        this->validateId(source, "Source vertex");
+        this->validateId(destination, "Destination vertex");
+        this->eraseEdge(source, destination);
+    }
+
+    /*
+        @brief      Gets the weight of a given edge.
+        @param      source The source vertex of the edge.
+        @param      destination The destination vertex of the edge.
+        @returns    `WeightT` The weight of the edge.
+        @throws     `std::runtime_error` If either the given source vertex or the given destination vertex does not exist in the graph,
+        @throws     or if no edge exists between the given vertices.
+    */
+    WeightT getWeight(const VertexT& source, const VertexT& destination) const
+    {
+        const VertexId_t sourceId = this->getExistingId(source, "Source vertex");
+        return this->findWeight(sourceId, this->getExistingId(destination, "Destination vertex"));
+    }
+
+    //  @brief      Id-based overload of `getWeight`, for interned vertices.
+    WeightT getWeight(const VertexId_t source, const VertexId_t destination) const requires IS_INTERNING
+    {
+        this->validateId(source, "Source vertex");
+        this->validateId(destination, "Destination vertex");
+        return this->findWeight(source, destination);
+    }
+
+    /*
+        @brief      Checks whether the graph is connected given a starting vertex.
+        @param      startingVertex The vertex starting from which the graph is to be checked.
+        @returns    `true` if the graph is connected, `false` otherwise.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the graph.
+        @note       The graph is connected if and only if all vertices are reachable from the given starting vertex.
+        @note       Reachable vertices are counted by a direction-optimizing breadth-first search, run in parallel on large graphs,
+        @note       on the shared thread pool of every hardware thread, see `ThreadPool::getShared`.
+    */
+    bool isConnected(const VertexT& startingVertex) const
+    {
+        return this->isReachingAll(this->getExistingId(startingVertex, "Starting vertex"));
+    }
+
+    //  @brief      Id-based overload of `isConnected`, for interned vertices.
+    bool isConnected(const VertexId_t startingVertex) const requires IS_INTERNING
+    {
+        this->validateId(startingVertex, "Starting vertex");
+        return this->isReachingAll(startingVertex);
+    }
+
+    /*
+        @brief      Checks whether the graph is a tree.
+        @returns    `std::pair<bool, VertexT>` `{true, root}` if the graph is a tree, `{false, VertexT()}` otherwise.
+        @note       The graph is a tree if and only if it is connected and the in-degree of every vertex is 1, except for one (inDegree(root) == 0).
+        @note       Connectivity is checked on the calling thread only, so that no thread is ever started.
+    */
+    std::pair<bool, VertexT> isTree(void) const noexcept
+    {
+        if (this->getOrder() == 0 || this->getSize() != this->getOrder() - 1)
+            return { false, VertexT() };
+        VertexId_t root = this->getIdBound();
+        for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
+        {
+            if (!this->containsId(vertex))
+                continue;
+            const size_t inDegree = this->incoming.getDegree(vertex);
+            if (inDegree > 1)
+                return { false, VertexT() };
+            if (inDegree == 0)
+                root = vertex;
+        }
+        auto& engine = getThreadLocalBfsEngine();
+        engine.run(*this, root);
+        if (engine.getReachedCount() == this->getOrder())
+            return { true, this->getName(root) };
+        return { false, VertexT() };
+    }
+
+    /*
+        @brief      Gets the depth-first search traversal of the graph given a starting vertex.
+        @param      startingVertex The vertex starting from which the depth-first search will begin.
+        @returns    `std::vector<VertexT>` The depth-first search traversal of the graph.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the graph.
+        @note       Neighbors are pushed in the order of the storage policy, i.e. in increasing id order for ordered storages.
+        @note       Interned vertices are thus visited in id order, i.e. by insertion order, where inserted vertices reuse the ids of removed ones,
+        @note       and not in the lexicographic order of their names.
+    */
+    std::vector<VertexT> getDFS(const VertexT& startingVertex) const
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getDFS", this->getMemoryResource());)
+        return this->getVertexNames(GraphKernels::dfs(*this, this->getExistingId(startingVertex, "Starting vertex")));
+    }
+
+    //  @brief      Id-based overload of `getDFS`, for interned vertices, returning vertex ids.
+    std::vector<VertexId_t> getDFS(const VertexId_t startingVertex) const requires IS_INTERNING
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getDFS", this->getMemoryResource());)
+        this->validateId(startingVertex, "Starting vertex");
+        return GraphKernels::dfs(*this, startingVertex);
+    }
+
+    /*
+        @brief      Gets the breadth-first search traversal of the graph given a starting vertex.
+        @param      startingVertex The vertex starting from which the breadth-first search will begin.
+        @returns    `std::vector<VertexT>` The breadth-first search traversal of the graph.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the graph.
+        @note       Neighbors are enqueued in the order of the storage policy, i.e. in increasing id order for ordered storages.
+        @note       Interned vertices are thus visited in id order, as in `getDFS`, and not in the lexicographic order of their names.
+    */
+    std::vector<VertexT> getBFS(const VertexT& startingVertex) const
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getBFS", this->getMemoryResource());)
+        return this->getVertexNames(GraphKernels::bfs(*this, this->getExistingId(startingVertex, "Starting vertex")));
+    }
+
+    //  @brief      Id-based overload of `getBFS`, for interned vertices, returning vertex ids.
+    std::vector<VertexId_t> getBFS(const VertexId_t startingVertex) const requires IS_INTERNING
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getBFS", this->getMemoryResource());)
+        this->validateId(startingVertex, "Starting vertex");
+        return GraphKernels::bfs(*this, startingVertex);
+    }
+
+    /*
+        @brief      Gets a lazy depth-first search traversal of the graph given a starting vertex, visiting the edges of a vertex only when advancing past it.
+        @param      startingVertex The vertex starting from which the depth-first search will begin.
+        @returns    `GraphKernels::DfsRange<Derived>` The input view yielding a `TraversalStep` (id, depth and parent) per vertex, see `TraversalRanges.hpp`.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the graph.
+        @note       Vertices are yielded in the order of `getDFS`. The graph must outlive the range and must not be modified while it is iterated.
+    */
+    GraphKernels::DfsRange<Derived> getDFSRange(const VertexT& startingVertex) const
+    {
+        return GraphKernels::DfsRange<Derived>(this->derived(), this->getExistingId(startingVertex, "Starting vertex"));
+    }
+
+    //  @brief      Id-based overload of `getDFSRange`, for interned vertices.
+    GraphKernels::DfsRange<Derived> getDFSRange(const VertexId_t startingVertex) const requires IS_INTERNING
+    {
+        this->validateId(startingVertex, "Starting vertex");
+        return GraphKernels::DfsRange<Derived>(this->derived(), startingVertex);
+    }
+
+    /*
+        @brief      Gets a lazy breadth-first search traversal of the graph given a starting vertex, visiting the edges of a vertex only when advancing past it.
+        @param      startingVertex The vertex starting from which the breadth-first search will begin.
+        @returns    `GraphKernels::BfsRange<Derived>` The input view yielding a `TraversalStep` (id, depth and parent) per vertex, see `TraversalRanges.hpp`.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the graph.
+        @note       Vertices are yielded in the order of `getBFS`. The graph must outlive the range and must not be modified while it is iterated.
+    */
+    GraphKernels::BfsRange<Derived> getBFSRange(const VertexT& startingVertex) const
+    {
+        return GraphKernels::BfsRange<Derived>(this->derived(), this->getExistingId(startingVertex, "Starting vertex"));
+    }
+
+    //  @brief      Id-based overload of `getBFSRange`, for interned vertices.
+    GraphKernels::BfsRange<Derived> getBFSRange(const VertexId_t startingVertex) const requires IS_INTERNING
+    {
+        this->validateId(startingVertex, "Starting vertex");
+        return GraphKernels::BfsRange<Derived>(this->derived(), startingVertex);
+    }
+
+    /*
+        @brief      Gets the breadth-first search tree of the graph given a starting vertex, using a parallel direction-optimizing search.
+        @param      startingVertex The vertex starting from which the breadth-first search will begin.
+        @param      threads The number of worker threads, or zero to use every hardware thread on large graphs and a single thread on small ones.
+        @returns    `BfsTree_t` The depth, i.e. the number of edges from the starting vertex, and the parent of every reachable vertex,
+        @returns    where the starting vertex is its own parent: mapped by vertex for interned vertices, and indexed by vertex otherwise,
+        @returns    respectively `SIZE_MAX` and `getIdBound()` for unreachable or non-existent vertices.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the graph.
+        @note       Depths are unique, but a vertex with several parents one level up may get any of them.
+    */
+    BfsTree_t getBFSTree(const VertexT& startingVertex, const unsigned threads) const
+    {
+        auto tree = this->getTree(this->getExistingId(startingVertex, "Starting vertex"), threads);
+        if constexpr (IS_INTERNING)
+        {
+            const auto& [depths, parents] = tree;
+            BfsTree_t reachable;
+            for (VertexId_t vertex = 0; vertex < depths.size(); ++vertex)
+                if (depths[vertex] != SIZE_MAX)
+                    reachable.emplace(this->vertexNames[vertex], std::pair{ depths[vertex], this->vertexNames[parents[vertex]] });
+            return reachable;
+        }
+        else
+            return tree;
+    }
+
+    /*
+        @brief      Id-based overload of `getBFSTree`, for interned vertices.
+        @returns    `std::pair<std::vector<size_t>, std::vector<VertexId_t>>` The depths and the parents indexed by vertex id,
+        @returns    respectively `SIZE_MAX` and `getIdBound()` for unreachable or non-existent vertices.
+    */
+    std::pair<std::vector<size_t>, std::vector<VertexId_t>> getBFSTree(const VertexId_t startingVertex, const unsigned threads) const requires IS_INTERNING
+    {
+        this->validateId(startingVertex, "Starting vertex");
+        return this->getTree(startingVertex, threads);
+    }
+
+    /*
+        @brief      Gets the shortest path from a given source vertex to each of the other reachable vertices, using Dijkstra's shortest paths algorithm.
+        @param      source The source vertex from which the shortest distances to each of the other reachable vertices is computed.
+        @returns    `DistanceMap_t` The distances of the reachable vertices: mapped by vertex for interned vertices, and indexed by vertex otherwise,
+        @returns    `SIZE_MAX` for unreachable or non-existent vertices.
+        @throws     `std::runtime_error` If the given source vertex does not exist in the graph.
+    */
+    DistanceMap_t getDijkstraShortestPaths(const VertexT& source) const
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getDijkstraShortestPaths", this->getMemoryResource());)
+        std::vector<size_t> minDistances = this->getDistances(this->getExistingId(source, "Starting vertex"));
+        if constexpr (IS_INTERNING)
+        {
+            DistanceMap_t reachable;
+            for (VertexId_t vertex = 0; vertex < minDistances.size(); ++vertex)
+                if (minDistances[vertex] != SIZE_MAX)
+                    reachable.emplace(this->vertexNames[vertex], minDistances[vertex]);
+            return reachable;
+        }
+        else
+            return minDistances;
+    }
+
+    /*
+        @brief      Id-based overload of `getDijkstraShortestPaths`, for interned vertices.
+        @returns    `std::vector<size_t>` The shortest distances indexed by vertex id, `SIZE_MAX` for unreachable or non-existent vertices.
+    */
+    std::vector<size_t> getDijkstraShortestPaths(const VertexId_t source) const requires IS_INTERNING
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getDijkstraShortestPaths", this->getMemoryResource());)
+        this->validateId(source, "Starting vertex");
+        return this->getDistances(source);
+    }
+
+    /*
+        @brief      Gets the shortest distances from a given source vertex to given target vertices, using Dijkstra's shortest paths algorithm.
+        @param      source The source vertex from which the shortest distances are computed.
+        @param      targets The target vertices to which the shortest distances are computed.
+        @returns    `DistanceMap_t` The reachable targets mapped to their distance for interned vertices, and otherwise the distance to each given target,
+        @returns    in the same order, `SIZE_MAX` for unreachable targets.
+        @throws     `std::runtime_error` If the given source vertex or any of the given target vertices does not exist in the graph.
+        @note       The search stops as soon as every target vertex is settled.
+    */
+    DistanceMap_t getDijkstraShortestPaths(const VertexT& source, const std::vector<VertexT>& targets) const
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getDijkstraShortestPaths", this->getMemoryResource());)
+        const VertexId_t sourceId = this->getExistingId(source, "Starting vertex");
+        std::vector<VertexId_t> targetIds;
+        targetIds.reserve(targets.size());
+        for (const VertexT& target : targets)
+            targetIds.push_back(this->getExistingId(target, "Target vertex"));
+        std::vector<size_t> minDistances = this->getDistances(sourceId, targetIds);
+        if constexpr (IS_INTERNING)
+        {
+            DistanceMap_t reachable;
+            for (size_t index = 0; index < targetIds.size(); ++index)
+                if (minDistances[index] != SIZE_MAX)
+                    reachable.emplace(this->vertexNames[targetIds[index]], minDistances[index]);
+            return reachable;
+        }
+        else
+            return minDistances;
+    }
+
+    /*
+        @brief      Id-based overload of `getDijkstraShortestPaths` to given targets, for interned vertices.
+        @returns    `std::vector<size_t>` The shortest distance to each given target, in the same order, `SIZE_MAX` for unreachable targets.
+    */
+    std::vector<size_t> getDijkstraShortestPaths(const VertexId_t source, const std::vector<VertexId_t>& targets) const requires IS_INTERNING
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getDijkstraShortestPaths", this->getMemoryResource());)
+        this->validateId(source, "Starting vertex");
+        for (const VertexId_t target : targets)
+            this->validateId(target, "Target vertex");
+        return this->getDistances(source, targets);
+    }
+
+    /*
+        @brief      Gets the shortest path from a given source vertex to a given target vertex, using Dijkstra's shortest paths algorithm.
+        @param      source The source vertex from which the shortest path starts.
+        @param      target The target vertex at which the shortest path ends.
+        @returns    `std::pair<size_t, std::vector<VertexT>>` `{distance, path}` where `path` lists the vertices from the source to the target,
+        @returns    or `{SIZE_MAX, {}}` if the target vertex is unreachable.
+        @throws     `std::runtime_error` If either the given source vertex or the given target vertex does not exist in the graph.
+        @note       The search stops as soon as the target vertex is settled.
+    */
+    std::pair<size_t, std::vector<VertexT>> getDijkstraShortestPath(const VertexT& source, const VertexT& target) const
+    {
+        const VertexId_t sourceId = this->getExistingId(source, "Starting vertex");
+        const auto [distance, path] = this->getPath(sourceId, this->getExistingId(target, "Target vertex"));
+        return { distance, this->getVertexNames(path) };
+    }
+
+    //  @brief      Id-based overload of `getDijkstraShortestPath`, for interned vertices.
+    std::pair<size_t, std::vector<VertexId_t>> getDijkstraShortestPath(const VertexId_t source, const VertexId_t target) const requires IS_INTERNING
+    {
+        this->validateId(source, "Starting vertex");
+        this->validateId(target, "Target vertex");
+        return this->getPath(source, target);
+    }
+
+    /*
+        @brief      Gets the shortest path from a given source vertex to a given target vertex, using a bidirectional Dijkstra search.
+        @param      source The source vertex from which the shortest path starts.
+        @param      target The target vertex at which the shortest path ends.
+        @returns    `std::pair<size_t, std::vector<VertexT>>` `{distance, path}` where `path` lists the vertices from the source to the target,
+        @returns    or `{SIZE_MAX, {}}` if the target vertex is unreachable.
+        @throws     `std::runtime_error` If either the given source vertex or the given target vertex does not exist in the graph.
+        @note       The backward search runs on the incoming-edge index.
+    */
+    std::pair<size_t, std::vector<VertexT>> getBidirectionalShortestPath(const VertexT& source, const VertexT& target) const
+    {
+        const VertexId_t sourceId = this->getExistingId(source, "Starting vertex");
+        const auto [distance, path] = this->getBidirectionalPath(sourceId, this->getExistingId(target, "Target vertex"));
+        return { distance, this->getVertexNames(path) };
+    }
+
+    //  @brief      Id-based overload of `getBidirectionalShortestPath`, for interned vertices.
+    std::pair<size_t, std::vector<VertexId_t>> getBidirectionalShortestPath(const VertexId_t source, const VertexId_t target) const requires IS_INTERNING
+    {
+        this->validateId(source, "Starting vertex");
+        this->validateId(target, "Target vertex");
+        return this->getBidirectionalPath(source, target);
+    }
+
+    /*
+        @brief      Gets the topological sort of the graph, using Kahn's topological sorting algorithm.
+        @returns    `std::pair<bool, std::vector<VertexT>>` `{true, sortedVertices}` if a topological sort exists, `{false, {}}` otherwise.
+        @note       A topological sort of the graph exists if and only if the graph is acyclic.
+        @note       Sources are dequeued in increasing id order, which is not the lexicographic order of the names of interned vertices, see `getDFS`.
+    */
+    std::pair<bool, std::vector<VertexT>> getKahnTopologicalSort(void) const noexcept
+    {
+        GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getKahnTopologicalSort", this->getMemoryResource());)
+        const auto [sortable, sortedIds] = GraphKernels::kahn(*this);
+        if (!sortable)
+            return { false, {} };
+        return { true, this->getVertexNames(sortedIds) };
+    }
+
+    /*
+        @brief      Calls a given visitor on each outgoing edge of the vertex of a given id, in the order of the storage policy.
+        @param      id The id of the vertex of which the outgoing edges are visited. It must exist in the graph.
+        @param      visitor The callable invoked as `visitor(neighborId, weight)` for each outgoing edge. If it returns `bool`, `false` stops the visit.
+    */
+    template <typename Visitor>
+    void forEachNeighbor(const VertexId_t id, Visitor&& visitor) const
+    {
+        this->outgoing.forEach(id, visitor);
+    }
+
+    /*
+        @brief      Calls a given visitor on each incoming edge of the vertex of a given id, in the order of the storage policy.
+        @param      id The id of the vertex of which the incoming edges are visited. It must exist in the graph.
+        @param      visitor The callable invoked as `visitor(predecessorId, weight)` for each incoming edge. If it returns `bool`, `false` stops the visit.
+    */
+    template <typename Visitor>
+    void forEachPredecessor(const VertexId_t id, Visitor&& visitor) const
+    {
+        this->incoming.forEach(id, visitor);
+    }
+};
+
+#endif // __GRAPH_WD_CORE_HPP_
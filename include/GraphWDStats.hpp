@@ -0,0 +1,126 @@
+/*
+    @headerfile     GraphWDStats.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the statistics of the graphs, and the instrumentation recording them, compiled out unless `GRAPH_WD_ENABLE_STATS` is defined.
+    @details        Kernels add their counts to the statistics of the calling thread, and the instrumented methods of the graphs open a
+    @details        `GraphStats::Scope` reporting them to the sink of the graph. Only the outermost scope of a thread reports, so that
+    @details        methods delegating to other instrumented methods are reported once.
+    @details        Allocations are counted by `GraphStats::CountingResource`, a memory resource given to the graph, so that they are credited
+    @details        to the call whichever thread makes them, and only the allocations of the graph itself are counted.
+*/
+
+#ifndef __GRAPH_WD_STATS_HPP_
+#define __GRAPH_WD_STATS_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string_view>
+#include <memory_resource>
+#include "GraphWDTypes.hpp"
+
+#ifdef GRAPH_WD_ENABLE_STATS
+#define GRAPH_WD_STATS(...) __VA_ARGS__
+#else
+#define GRAPH_WD_STATS(...)
+#endif
+
+namespace GraphStats
+{
+    /*
+        @struct     Stats
+        @brief      Describes the work done by a call to an instrumented method, see `GraphWDCore::setStatsSink`, and named `GraphWD::Stats`.
+        @details    `settledVertices` counts the vertices settled by Dijkstra's algorithm, or visited by a traversal or a topological sort.
+        @details    `relaxedEdges` counts the outgoing edges scanned from those vertices, or the edges inserted or removed by a mutation.
+        @details    `pushes` and `stalePops` count the insertions into the heap, stack or queue of the call, and the outdated entries popped from it.
+        @details    `peakFrontier` is the largest size reached by that heap, stack or queue, and `allocations` counts the allocations of the containers of the graph during the call,
+        @details    if the graph allocates from a `GraphStats::CountingResource`, and is zero otherwise.
+    */
+    struct Stats
+    {
+        std::string_view operation;
+        size_t settledVertices = 0;
+        size_t relaxedEdges = 0;
+        size_t pushes = 0;
+        size_t stalePops = 0;
+        size_t peakFrontier = 0;
+        size_t allocations = 0;
+        std::chrono::nanoseconds wallTime{ 0 };
+    };
+
+    //  @typedef    Sink
+    //  @brief      The callable receiving the statistics of every successful call to an instrumented method, named `GraphWD::StatsSink`.
+    typedef std::function<void(const Stats&)> Sink;
+
+    /*
+        @class      CountingResource
+        @brief      Counts the allocations made from it, and forwards them to an upstream memory resource.
+        @details    A graph constructed with a counting resource reports in `Stats::allocations` the allocations of its containers
+        @details    during each instrumented call, made on any thread. Graphs allocating from any other resource report zero allocations.
+        @note       The resource is thread-safe if its upstream resource is, and must outlive the graphs allocating from it.
+    */
+    class CountingResource final : public std::pmr::memory_resource
+    {
+    private:
+        std::pmr::memory_resource* const upstream;
+        std::atomic<size_t> allocationCount{ 0 };
+
+        void* do_allocate(const size_t bytes, const size_t alignment) override;
+
+        void do_deallocate(void* const pointer, const size_t bytes, const size_t alignment) override;
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    public:
+        //  @brief      Creates a counting resource forwarding to a given upstream resource, by default the default memory resource.
+        explicit CountingResource(std::pmr::memory_resource* const upstream = std::pmr::get_default_resource()) noexcept;
+
+        //  @brief      Gets the number of allocations made from the resource since its creation.
+        size_t getAllocationCount(void) const noexcept;
+    };
+}
+
+#ifdef GRAPH_WD_ENABLE_STATS
+namespace GraphStats
+{
+    //  @brief      Gets the statistics recorded by the calling thread since its outermost scope was opened.
+    Stats& getCurrent(void) noexcept;
+
+    //  @brief      Raises the peak frontier of given statistics to a given frontier size.
+    inline void updatePeakFrontier(Stats& stats, const size_t frontier) noexcept
+    {
+        if (frontier > stats.peakFrontier)
+            stats.peakFrontier = frontier;
+    }
+
+    /*
+        @class      Scope
+        @brief      Records the statistics of an instrumented call, and reports them to a sink when the call returns without throwing.
+    */
+    class Scope final
+    {
+    private:
+        const Sink& sink;
+        const std::string_view operation;
+        const CountingResource* const resource;
+        const bool isOutermost;
+        const int uncaughtExceptions;
+        size_t allocations = 0;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        //  @brief      Opens a scope reporting to a given sink, counting the allocations from a given resource if it is a `CountingResource`.
+        Scope(const Sink& sink, const std::string_view operation, const std::pmr::memory_resource* const resource) noexcept;
+
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+
+        Scope& operator=(const Scope&) = delete;
+    };
+}
+#endif // GRAPH_WD_ENABLE_STATS
+
+#endif // __GRAPH_WD_STATS_HPP_
@@ -0,0 +1,22 @@
+/*
+    @headerfile     GraphWDTypes.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the vertex types shared by the graphs of the library and by their kernels and engines.
+    @note           Headers only needing these types include this header instead of `GraphWD.hpp`, which itself depends on them.
+*/
+
+#ifndef __GRAPH_WD_TYPES_HPP_
+#define __GRAPH_WD_TYPES_HPP_
+
+#include <string>
+#include <cstdint>
+
+// @typedef Vertex_t
+typedef std::string Vertex_t;
+
+// @typedef VertexId_t
+typedef std::uint32_t VertexId_t;
+
+#endif // __GRAPH_WD_TYPES_HPP_
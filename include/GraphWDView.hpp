@@ -0,0 +1,251 @@
+/*
+    @headerfile     GraphWDView.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines an immutable, compressed-sparse-row snapshot of a `GraphWD`.
+    @note           A view is obtained through `GraphWD::freeze()`, and is unaffected by later modifications of the graph,
+    @note           or through `GraphWD::openMapped()`, and then runs directly on the memory-mapped pages of a saved graph.
+*/
+
+#ifndef __GRAPH_WD_VIEW_HPP_
+#define __GRAPH_WD_VIEW_HPP_
+
+#include <map>
+#include <span>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include "GraphWD.hpp"
+
+/*
+    @class      GraphWDView
+    @brief      Stores a frozen weighted and directed graph in compressed-sparse-row layout, for read-heavy algorithm workloads.
+    @details    Vertices keep the ids they have in the frozen graph, so that every neighbor step is a contiguous array access.
+    @details    The outgoing edges of the vertex of id `i` are found at indices `[offsets[i], offsets[i + 1])` of `targets` and `weights`,
+    @details    and its name at indices `[nameOffsets[i], nameOffsets[i + 1])` of `nameChars`, empty for removed ids.
+    @details    The arrays are spans over a storage shared by all copies of the view: owned buffers, or the mapping of a saved graph.
+*/
+class GraphWDView final
+{
+    friend GraphWD;
+
+private:
+    //  @struct     Buffers
+    //  @brief      The arrays of a view owning its storage, as produced by `GraphWD::freeze()`.
+    struct Buffers
+    {
+        std::vector<std::uint64_t> nameOffsets;
+        std::vector<char> nameChars;
+        std::vector<VertexId_t> sortedIds;
+        std::vector<std::uint64_t> offsets;
+        std::vector<VertexId_t> targets;
+        std::vector<std::uint64_t> weights;
+    };
+
+    std::shared_ptr<const void> storage;
+    std::span<const std::uint64_t> nameOffsets;
+    std::span<const char> nameChars;
+    std::span<const VertexId_t> sortedIds;
+    std::span<const std::uint64_t> offsets;
+    std::span<const VertexId_t> targets;
+    std::span<const std::uint64_t> weights;
+
+    GraphWDView(void) = default;
+
+    /*
+        @brief      Gets the name of the vertex of a given id, without checking that it exists.
+        @param      id The id of the vertex, strictly less than `getIdBound()`.
+        @returns    `std::string_view` The name of the vertex, empty for a removed id.
+    */
+    std::string_view getName(const VertexId_t id) const noexcept
+    {
+        return { this->nameChars.data() + this->nameOffsets[id], this->nameOffsets[id + 1] - this->nameOffsets[id] };
+    }
+
+    /*
+        @brief      Gets the id of a given vertex.
+        @param      vertex The vertex of which the id is to be found.
+        @returns    `VertexId_t` The id of the given vertex, or `getIdBound()` if it does not exist in the view.
+    */
+    VertexId_t findVertexId(const Vertex_t& vertex) const noexcept;
+
+    /*
+        @brief      Maps given vertex ids to their respective vertex names.
+        @param      ids The ids to be mapped.
+        @returns    `std::vector<Vertex_t>` The names of the given ids, in the same order.
+    */
+    std::vector<Vertex_t> getVertexNames(const std::vector<VertexId_t>& ids) const;
+
+public:
+    /*
+        @brief      Gets the order (number of vertices) of the view.
+        @returns    `size_t` The order of the view.
+    */
+    size_t getOrder(void) const noexcept;
+
+    /*
+        @brief      Gets the size (number of edges) of the view.
+        @returns    `size_t` The size of the view.
+    */
+    size_t getSize(void) const noexcept;
+
+    /*
+        @brief      Gets the id bound of the view, such that every vertex id in use is strictly less than it.
+        @returns    `VertexId_t` The id bound of the view.
+    */
+    VertexId_t getIdBound(void) const noexcept;
+
+    /*
+        @brief      Checks whether a vertex of a given id exists in the view.
+        @param      id The id of which the existence is to be checked.
+        @returns    `true` if a vertex of the given id exists in the view, `false` otherwise.
+    */
+    bool containsVertex(const VertexId_t id) const noexcept;
+
+    /*
+        @brief      Gets the id of a given vertex.
+        @param      vertex The vertex of which the id is to be found.
+        @returns    `VertexId_t` The id of the given vertex, identical to its id in the frozen graph.
+        @throws     `std::runtime_error` If the given vertex does not exist in the view.
+    */
+    VertexId_t getVertexId(const Vertex_t& vertex) const;
+
+    /*
+        @brief      Gets the vertex of a given id.
+        @param      id The id of which the vertex is to be found.
+        @returns    `std::string_view` The vertex of the given id, pointing into the storage of the view.
+        @throws     `std::runtime_error` If no vertex of the given id exists in the view.
+    */
+    std::string_view getVertexName(const VertexId_t id) const;
+
+    /*
+        @brief      Gets the out-degree (number of outgoing edges) of a given vertex.
+        @param      vertex The vertex of which the out-degree is to be computed.
+        @returns    `size_t` The out-degree of the given vertex.
+        @throws     `std::runtime_error` If the given vertex does not exist in the view.
+    */
+    size_t getOutDegree(const Vertex_t& vertex) const;
+
+    /*
+        @brief      Gets the depth-first search traversal of the view given a starting vertex.
+        @param      startingVertex The vertex starting from which the depth-first search will begin.
+        @returns    `std::vector<Vertex_t>` The depth-first search traversal of the view.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the view.
+        @note       The traversal is identical to the one returned by `GraphWD::getDFS` on the frozen graph.
+    */
+    std::vector<Vertex_t> getDFS(const Vertex_t& startingVertex) const;
+
+    //  @brief      Id-based overload of `std::vector<Vertex_t> GraphWDView::getDFS(const Vertex_t& startingVertex) const`, returning vertex ids.
+    std::vector<VertexId_t> getDFS(const VertexId_t startingVertex) const;
+
+    /*
+        @brief      Gets the breadth-first search traversal of the view given a starting vertex.
+        @param      startingVertex The vertex starting from which the breadth-first search will begin.
+        @returns    `std::vector<Vertex_t>` The breadth-first search traversal of the view.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the view.
+        @note       The traversal is identical to the one returned by `GraphWD::getBFS` on the frozen graph.
+    */
+    std::vector<Vertex_t> getBFS(const Vertex_t& startingVertex) const;
+
+    //  @brief      Id-based overload of `std::vector<Vertex_t> GraphWDView::getBFS(const Vertex_t& startingVertex) const`, returning vertex ids.
+    std::vector<VertexId_t> getBFS(const VertexId_t startingVertex) const;
+
+    /*
+        @brief      Gets a lazy depth-first search traversal of the view given a starting vertex, visiting the edges of a vertex only when advancing past it.
+        @param      startingVertex The vertex starting from which the depth-first search will begin.
+        @returns    `GraphKernels::DfsRange<GraphWDView>` The input view yielding a `TraversalStep` (id, depth and parent) per vertex, see `TraversalRanges.hpp`.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the view.
+        @note       Vertices are yielded in the order of `getDFS`. The view must outlive the range and must not be modified while it is iterated.
+    */
+    GraphKernels::DfsRange<GraphWDView> getDFSRange(const Vertex_t& startingVertex) const;
+
+    //  @brief      Id-based overload of `GraphKernels::DfsRange<GraphWDView> GraphWDView::getDFSRange(const Vertex_t& startingVertex) const`.
+    GraphKernels::DfsRange<GraphWDView> getDFSRange(const VertexId_t startingVertex) const;
+
+    /*
+        @brief      Gets a lazy breadth-first search traversal of the view given a starting vertex, visiting the edges of a vertex only when advancing past it.
+        @param      startingVertex The vertex starting from which the breadth-first search will begin.
+        @returns    `GraphKernels::BfsRange<GraphWDView>` The input view yielding a `TraversalStep` (id, depth and parent) per vertex, see `TraversalRanges.hpp`.
+        @throws     `std::runtime_error` If the given starting vertex does not exist in the view.
+        @note       Vertices are yielded in the order of `getBFS`. The view must outlive the range and must not be modified while it is iterated.
+    */
+    GraphKernels::BfsRange<GraphWDView> getBFSRange(const Vertex_t& startingVertex) const;
+
+    //  @brief      Id-based overload of `GraphKernels::BfsRange<GraphWDView> GraphWDView::getBFSRange(const Vertex_t& startingVertex) const`.
+    GraphKernels::BfsRange<GraphWDView> getBFSRange(const VertexId_t startingVertex) const;
+
+    /*
+        @brief      Gets the shortest path from a given source vertex to each of the other reachable vertices, using Dijkstra's shortest paths algorithm.
+        @param      source The source vertex from which the shortest distances to each of the other reachable vertices is computed.
+        @returns    `std::map<Vertex_t, size_t>` The reachable vertices and their respective shortest distance from the source vertex.
+        @throws     `std::runtime_error` If the given source vertex does not exist in the view.
+    */
+    std::map<Vertex_t, size_t> getDijkstraShortestPaths(const Vertex_t& source) const;
+
+    /*
+        @brief      Id-based overload of `std::map<Vertex_t, size_t> GraphWDView::getDijkstraShortestPaths(const Vertex_t& source) const`.
+        @returns    `std::vector<size_t>` The shortest distances indexed by vertex id, `SIZE_MAX` for unreachable or non-existent vertices.
+    */
+    std::vector<size_t> getDijkstraShortestPaths(const VertexId_t source) const;
+
+    /*
+        @brief      Gets the shortest distances from a given source vertex to given target vertices, using Dijkstra's shortest paths algorithm.
+        @param      source The source vertex from which the shortest distances are computed.
+        @param      targets The target vertices to which the shortest distances are computed.
+        @returns    `std::map<Vertex_t, size_t>` The reachable target vertices and their respective shortest distance from the source vertex.
+        @throws     `std::runtime_error` If the given source vertex or any of the given target vertices does not exist in the view.
+        @note       The search stops as soon as every target vertex is settled.
+    */
+    std::map<Vertex_t, size_t> getDijkstraShortestPaths(const Vertex_t& source, const std::vector<Vertex_t>& targets) const;
+
+    /*
+        @brief      Id-based overload of `std::map<Vertex_t, size_t> GraphWDView::getDijkstraShortestPaths(const Vertex_t& source, const std::vector<Vertex_t>& targets) const`.
+        @returns    `std::vector<size_t>` The shortest distance to each given target, in the same order, `SIZE_MAX` for unreachable targets.
+    */
+    std::vector<size_t> getDijkstraShortestPaths(const VertexId_t source, const std::vector<VertexId_t>& targets) const;
+
+    /*
+        @brief      Gets the shortest path from a given source vertex to a given target vertex, using Dijkstra's shortest paths algorithm.
+        @param      source The source vertex from which the shortest path starts.
+        @param      target The target vertex at which the shortest path ends.
+        @returns    `std::pair<size_t, std::vector<Vertex_t>>` `{distance, path}` where `path` lists the vertices from the source to the target,
+        @returns    or `{SIZE_MAX, {}}` if the target vertex is unreachable.
+        @throws     `std::runtime_error` If either the given source vertex or the given target vertex does not exist in the view.
+        @note       The search stops as soon as the target vertex is settled.
+    */
+    std::pair<size_t, std::vector<Vertex_t>> getDijkstraShortestPath(const Vertex_t& source, const Vertex_t& target) const;
+
+    //  @brief      Id-based overload of `std::pair<size_t, std::vector<Vertex_t>> GraphWDView::getDijkstraShortestPath(const Vertex_t& source, const Vertex_t& target) const`.
+    std::pair<size_t, std::vector<VertexId_t>> getDijkstraShortestPath(const VertexId_t source, const VertexId_t target) const;
+
+    /*
+        @brief      Gets the topological sort of the view, using Kahn's topological sorting algorithm.
+        @returns    `std::pair<bool, std::vector<Vertex_t>>` `{true, sortedVertices}` if a topological sort exists, `{false, {}}` otherwise.
+        @note       A topological sort of the view exists if and only if the view is acyclic.
+    */
+    std::pair<bool, std::vector<Vertex_t>> getKahnTopologicalSort(void) const noexcept;
+
+    /*
+        @brief      Calls a given visitor on each outgoing edge of the vertex of a given id, in increasing neighbor id order.
+        @param      id The id of the vertex of which the outgoing edges are visited. It must exist in the view.
+        @param      visitor The callable invoked as `visitor(neighborId, weight)` for each outgoing edge. If it returns `bool`, `false` stops the visit.
+    */
+    template <typename Visitor>
+    void forEachNeighbor(const VertexId_t id, Visitor&& visitor) const
+    {
+        for (size_t edge = this->offsets[id]; edge < this->offsets[id + 1]; ++edge)
+            if constexpr (std::is_same_v<std::invoke_result_t<Visitor&, VertexId_t, size_t>, bool>)
+            {
+                if (!visitor(this->targets[edge], this->weights[edge]))
+                    return;
+            }
+            else
+                visitor(this->targets[edge], this->weights[edge]);
+    }
+};
+
+#endif // __GRAPH_WD_VIEW_HPP_
@@ -0,0 +1,143 @@
+/*
+    @headerfile     LandmarkIndex.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the landmark distance tables used by A* searches to bound distances from below (ALT).
+    @details        For every landmark `L`, the shortest distances from `L` to every vertex and from every vertex to `L` are stored.
+    @details        By the triangle inequality, `d(v, t) >= d(L, t) - d(L, v)` and `d(v, t) >= d(v, L) - d(t, L)`, which yields a consistent heuristic.
+    @note           The tables must be rebuilt after the graph is modified, since they are only valid for the graph they were built on.
+*/
+
+#ifndef __LANDMARK_INDEX_HPP_
+#define __LANDMARK_INDEX_HPP_
+
+#include <vector>
+#include <algorithm>
+#include "GraphWD.hpp"
+#include "GraphKernels.hpp"
+#include "DijkstraEngine.hpp"
+
+/*
+    @class      LandmarkIndex
+    @brief      Stores the distances from and to a set of landmark vertices, laid out vertex-major for cache-friendly lookups.
+*/
+class LandmarkIndex final
+{
+private:
+    std::vector<VertexId_t> landmarks;
+    std::vector<size_t> fromLandmarks;
+    std::vector<size_t> toLandmarks;
+
+public:
+    /*
+        @brief      Selects landmarks by farthest insertion: every new landmark is the vertex farthest from all previous ones.
+        @param      graph The graph in which the landmarks are selected.
+        @param      count The maximum number of landmarks to be selected.
+        @returns    `std::vector<VertexId_t>` The ids of the selected landmarks.
+        @note       Vertices unreachable from every previous landmark are preferred, so that all components end up covered.
+    */
+    template <typename Graph>
+    static std::vector<VertexId_t> selectFarthestLandmarks(const Graph& graph, const size_t count)
+    {
+        std::vector<VertexId_t> selected;
+        VertexId_t candidate = 0;
+        while (candidate < graph.getIdBound() && !graph.containsVertex(candidate))
+            ++candidate;
+        if (candidate == graph.getIdBound() || count == 0)
+            return selected;
+        DijkstraEngine<> engine;
+        engine.run(graph, candidate);
+        candidate = engine.getSettled().back();
+        std::vector<size_t> coverage(graph.getIdBound(), SIZE_MAX);
+        while (selected.size() < count)
+        {
+            selected.push_back(candidate);
+            engine.run(graph, candidate);
+            for (const VertexId_t vertex : engine.getSettled())
+                coverage[vertex] = std::min(coverage[vertex], engine.getDistance(vertex));
+            size_t farthest = 0;
+            for (VertexId_t vertex = 0; vertex < graph.getIdBound(); ++vertex)
+                if (graph.containsVertex(vertex) && coverage[vertex] > farthest)
+                {
+                    farthest = coverage[vertex];
+                    candidate = vertex;
+                }
+            if (farthest == 0)
+                break;
+        }
+        return selected;
+    }
+
+    /*
+        @brief      Builds the distance tables of given landmarks.
+        @param      graph The graph on which the tables are built. It must provide `forEachPredecessor`.
+        @param      landmarks The ids of the landmarks, which must exist in the graph.
+    */
+    template <typename Graph>
+    void build(const Graph& graph, const std::vector<VertexId_t>& landmarks)
+    {
+        const size_t count = landmarks.size();
+        this->landmarks = landmarks;
+        this->fromLandmarks.assign(graph.getIdBound() * count, SIZE_MAX);
+        this->toLandmarks.assign(graph.getIdBound() * count, SIZE_MAX);
+        DijkstraEngine<> engine;
+        for (size_t index = 0; index < count; ++index)
+        {
+            engine.run(graph, landmarks[index]);
+            for (const VertexId_t vertex : engine.getSettled())
+                this->fromLandmarks[vertex * count + index] = engine.getDistance(vertex);
+            engine.run(GraphKernels::ReverseGraph<Graph>(graph), landmarks[index]);
+            for (const VertexId_t vertex : engine.getSettled())
+                this->toLandmarks[vertex * count + index] = engine.getDistance(vertex);
+        }
+    }
+
+    /*
+        @brief      Gets the landmarks of the index.
+        @returns    `const std::vector<VertexId_t>&` The ids of the landmarks.
+    */
+    const std::vector<VertexId_t>& getLandmarks(void) const noexcept
+    {
+        return this->landmarks;
+    }
+
+    /*
+        @brief      Gets a lower bound of the shortest distance between two given vertices.
+        @param      source The id of the vertex from which the distance is bounded.
+        @param      target The id of the vertex to which the distance is bounded.
+        @returns    `size_t` The lower bound, or `SIZE_MAX` if the target is provably unreachable from the source.
+        @note       Vertices outside the tables, e.g. inserted after they were built, are bounded by zero.
+    */
+    size_t getLowerBound(const VertexId_t source, const VertexId_t target) const noexcept
+    {
+        const size_t count = this->landmarks.size();
+        if (count == 0 || (static_cast<size_t>(std::max(source, target)) + 1) * count > this->fromLandmarks.size())
+            return 0;
+        const size_t* const fromSource = &this->fromLandmarks[source * count];
+        const size_t* const fromTarget = &this->fromLandmarks[target * count];
+        const size_t* const toSource = &this->toLandmarks[source * count];
+        const size_t* const toTarget = &this->toLandmarks[target * count];
+        size_t bound = 0;
+        for (size_t index = 0; index < count; ++index)
+        {
+            if (fromSource[index] != SIZE_MAX)
+            {
+                if (fromTarget[index] == SIZE_MAX)
+                    return SIZE_MAX;
+                if (fromTarget[index] > fromSource[index])
+                    bound = std::max(bound, fromTarget[index] - fromSource[index]);
+            }
+            if (toTarget[index] != SIZE_MAX)
+            {
+                if (toSource[index] == SIZE_MAX)
+                    return SIZE_MAX;
+                if (toSource[index] > toTarget[index])
+                    bound = std::max(bound, toSource[index] - toTarget[index]);
+            }
+        }
+        return bound;
+    }
+};
+
+#endif // __LANDMARK_INDEX_HPP_
@@ -0,0 +1,208 @@
+/*
+    @headerfile     PriorityQueues.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the min-priority queues of vertex ids pluggable into `DijkstraEngine`.
+    @details        A queue provides the following methods, with keys of type `size_t`:
+    @details        `void reset(const VertexId_t idBound)`, emptying the queue and preparing it for ids strictly less than `idBound`,
+    @details        `bool empty(void) const`, `size_t size(void) const`,
+    @details        `void push(const VertexId_t id, const size_t key)`, inserting the given id or lowering its key,
+    @details        `std::pair<size_t, VertexId_t> pop(void)`, removing and returning an entry of minimum key.
+    @note           A queue may return stale entries (a lazy queue), which `DijkstraEngine` skips.
+*/
+
+#ifndef __PRIORITY_QUEUES_HPP_
+#define __PRIORITY_QUEUES_HPP_
+
+#include <bit>
+#include <array>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "GraphWDTypes.hpp"
+
+/*
+    @class      IndexedDaryHeap
+    @brief      Defines an indexed d-ary min-heap of vertex ids, supporting decrease-key.
+    @details    The position of every id in the heap is tracked, so that an id is stored at most once and never popped stale.
+    @tparam     Arity The number of children of every node, trading shallower trees for wider sift-downs.
+*/
+template <unsigned Arity = 4>
+class IndexedDaryHeap final
+{
+    static_assert(Arity >= 2, "A heap node must have at least two children.");
+
+private:
+    static constexpr std::uint32_t ABSENT = UINT32_MAX;
+
+    std::vector<std::pair<size_t, VertexId_t>> heap;
+    std::vector<std::uint32_t> positions;
+
+    //  @brief      Moves the entry at a given index up until its parent has a smaller or equal key.
+    void siftUp(size_t index) noexcept
+    {
+        const auto entry = this->heap[index];
+        while (index > 0)
+        {
+            const size_t parent = (index - 1) / Arity;
+            if (this->heap[parent].first <= entry.first)
+                break;
+            this->heap[index] = this->heap[parent];
+            this->positions[this->heap[index].second] = static_cast<std::uint32_t>(index);
+            index = parent;
+        }
+        this->heap[index] = entry;
+        this->positions[entry.second] = static_cast<std::uint32_t>(index);
+    }
+
+    //  @brief      Moves the entry at a given index down until all its children have greater or equal keys.
+    void siftDown(size_t index) noexcept
+    {
+        const auto entry = this->heap[index];
+        while (true)
+        {
+            const size_t firstChild = index * Arity + 1;
+            if (firstChild >= this->heap.size())
+                break;
+            const size_t lastChild = std::min(firstChild + Arity, this->heap.size());
+            size_t minChild = firstChild;
+            for (size_t child = firstChild + 1; child < lastChild; ++child)
+                if (this->heap[child].first < this->heap[minChild].first)
+                    minChild = child;
+            if (this->heap[minChild].first >= entry.first)
+                break;
+            this->heap[index] = this->heap[minChild];
+            this->positions[this->heap[index].second] = static_cast<std::uint32_t>(index);
+            index = minChild;
+        }
+        this->heap[index] = entry;
+        this->positions[entry.second] = static_cast<std::uint32_t>(index);
+    }
+
+public:
+    //  @brief      Empties the heap, and prepares it for ids strictly less than a given bound.
+    void reset(const VertexId_t idBound)
+    {
+        for (const auto& [_, id] : this->heap)
+            this->positions[id] = ABSENT;
+        this->heap.clear();
+        if (this->positions.size() < idBound)
+            this->positions.resize(idBound, ABSENT);
+    }
+
+    //  @brief      Checks whether the heap is empty.
+    bool empty(void) const noexcept
+    {
+        return this->heap.empty();
+    }
+
+    //  @brief      Gets the number of entries in the heap.
+    size_t size(void) const noexcept
+    {
+        return this->heap.size();
+    }
+
+    //  @brief      Inserts a given id with a given key, or lowers its key if it is already in the heap.
+    void push(const VertexId_t id, const size_t key)
+    {
+        const std::uint32_t position = this->positions[id];
+        if (position == ABSENT)
+        {
+            this->heap.push_back({ key, id });
+            this->siftUp(this->heap.size() - 1);
+        }
+        else if (key < this->heap[position].first)
+        {
+            this->heap[position].first = key;
+            this->siftUp(position);
+        }
+    }
+
+    //  @brief      Removes and returns the entry of minimum key. The heap must not be empty.
+    std::pair<size_t, VertexId_t> pop(void) noexcept
+    {
+        const auto top = this->heap.front();
+        this->positions[top.second] = ABSENT;
+        const auto last = this->heap.back();
+        this->heap.pop_back();
+        if (!this->heap.empty())
+        {
+            this->heap.front() = last;
+            this->siftDown(0);
+        }
+        return top;
+    }
+};
+
+/*
+    @class      RadixHeap
+    @brief      Defines a monotone radix heap of vertex ids, for integer keys.
+    @details    Entries are bucketed by the highest bit in which their key differs from the last popped key, so that each entry moves
+    @details    down at most 64 buckets over its lifetime. Lowering a key pushes a new entry, leaving the old one to be popped stale.
+    @note       Every pushed key must be greater than or equal to the last popped key, which holds for Dijkstra's algorithm.
+*/
+class RadixHeap final
+{
+private:
+    std::array<std::vector<std::pair<size_t, VertexId_t>>, 65> buckets;
+    size_t lastKey = 0;
+    size_t count = 0;
+
+    //  @brief      Gets the bucket of a given key relative to the last popped key.
+    size_t getBucket(const size_t key) const noexcept
+    {
+        return key == this->lastKey ? 0 : 64 - std::countl_zero(key ^ this->lastKey);
+    }
+
+public:
+    //  @brief      Empties the heap.
+    void reset(const VertexId_t)
+    {
+        for (auto& bucket : this->buckets)
+            bucket.clear();
+        this->lastKey = 0;
+        this->count = 0;
+    }
+
+    //  @brief      Checks whether the heap is empty.
+    bool empty(void) const noexcept
+    {
+        return this->count == 0;
+    }
+
+    //  @brief      Gets the number of entries in the heap.
+    size_t size(void) const noexcept
+    {
+        return this->count;
+    }
+
+    //  @brief      Inserts a given id with a given key, which must not be less than the last popped key.
+    void push(const VertexId_t id, const size_t key)
+    {
+        this->buckets[this->getBucket(key)].push_back({ key, id });
+        ++this->count;
+    }
+
+    //  @brief      Removes and returns an entry of minimum key, possibly stale. The heap must not be empty.
+    std::pair<size_t, VertexId_t> pop(void)
+    {
+        if (this->buckets[0].empty())
+        {
+            size_t index = 1;
+            while (this->buckets[index].empty())
+                ++index;
+            auto& bucket = this->buckets[index];
+            this->lastKey = std::min_element(bucket.begin(), bucket.end())->first;
+            for (const auto& entry : bucket)
+                this->buckets[this->getBucket(entry.first)].push_back(entry);
+            bucket.clear();
+        }
+        const auto top = this->buckets[0].back();
+        this->buckets[0].pop_back();
+        --this->count;
+        return top;
+    }
+};
+
+#endif // __PRIORITY_QUEUES_HPP_
@@ -0,0 +1,126 @@
+/*
+    @headerfile     ShortestPathCache.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the opt-in cache of the shortest path trees computed by `GraphWD::getDijkstraShortestPaths`.
+    @details        Trees are keyed by their source, and evicted in least-recently-used order beyond a number of entries or of bytes.
+    @details        The cache follows the version of its graph: every mutation only drops the trees it can change, and a version the cache
+    @details        did not follow (which mutations of the graph never cause) drops every tree.
+    @details        - Removing the edge `u -> v` drops the trees in which `u` is the predecessor of `v`, i.e. the trees using the edge.
+    @details        - Inserting the edge `u -> v` of weight `w` drops the trees in which `distance(u) + w < distance(v)`, i.e. the trees it improves.
+    @details        - Removing a vertex drops the trees reaching it, and inserting a vertex drops nothing.
+    @note           Lookups and insertions are thread-safe, so that `const` queries of the graph can run concurrently.
+*/
+
+#ifndef __SHORTEST_PATH_CACHE_HPP_
+#define __SHORTEST_PATH_CACHE_HPP_
+
+#include <list>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include "GraphWD.hpp"
+
+/*
+    @class      ShortestPathCache
+    @brief      Stores shortest path trees by source vertex, bounded by a number of entries and of bytes.
+*/
+class ShortestPathCache final
+{
+public:
+    //  @struct     Tree
+    //  @brief      A cached shortest path tree, indexed by vertex id: `SIZE_MAX` distances mark unreachable vertices, ids at least `size()` included.
+    struct Tree
+    {
+        std::vector<size_t> distances;
+        std::vector<VertexId_t> predecessors;
+
+        //  @brief      Gets the distance of the vertex of a given id, or `SIZE_MAX` if it is unreachable.
+        size_t getDistance(const VertexId_t id) const noexcept
+        {
+            return id < this->distances.size() ? this->distances[id] : SIZE_MAX;
+        }
+    };
+
+private:
+    //  @struct     Entry
+    //  @brief      A cached tree with its source and its size in bytes.
+    struct Entry
+    {
+        VertexId_t source;
+        std::shared_ptr<const Tree> tree;
+        size_t bytes;
+    };
+
+    const size_t maxEntries;
+    const size_t maxBytes;
+    size_t bytes = 0;
+    size_t version;
+    GraphWD::CacheCounters counters;
+    std::list<Entry> entries;
+    std::unordered_map<VertexId_t, std::list<Entry>::iterator> index;
+    mutable std::mutex mutex;
+
+    //  @brief      Removes a given entry.
+    void erase(const std::list<Entry>::iterator itEntry);
+
+    //  @brief      Drops every tree if the cache missed a version, and follows a given version.
+    void synchronize(const size_t graphVersion);
+
+    //  @brief      Drops the trees satisfying a given predicate, called as `predicate(tree, source)`, after a mutation producing a given version.
+    template <typename Predicate>
+    void invalidateIf(const size_t newVersion, Predicate&& predicate);
+
+public:
+    /*
+        @brief      Creates an empty cache for a graph of a given version.
+        @param      maxEntries The maximum number of cached trees.
+        @param      maxBytes The maximum number of bytes of the cached trees. Larger trees are never cached.
+        @param      version The current version of the graph.
+    */
+    ShortestPathCache(const size_t maxEntries, const size_t maxBytes, const size_t version) noexcept;
+
+    //  @brief      Gets the maximum number of cached trees.
+    size_t getMaxEntries(void) const noexcept;
+
+    //  @brief      Gets the maximum number of bytes of the cached trees.
+    size_t getMaxBytes(void) const noexcept;
+
+    /*
+        @brief      Looks up the tree of a given source, counting a hit or a miss, and marks it as the most recently used.
+        @param      source The id of the source vertex.
+        @param      graphVersion The current version of the graph.
+        @returns    `std::shared_ptr<const Tree>` The tree, or `nullptr` if it is not cached.
+    */
+    std::shared_ptr<const Tree> find(const VertexId_t source, const size_t graphVersion);
+
+    /*
+        @brief      Caches the tree of a given source, evicting the least recently used trees beyond the limits.
+        @param      source The id of the source vertex.
+        @param      graphVersion The version of the graph from which the tree was computed.
+        @param      tree The tree.
+    */
+    void insert(const VertexId_t source, const size_t graphVersion, std::shared_ptr<const Tree> tree);
+
+    //  @brief      Drops the trees improved by the insertion of the edge `source -> destination`, which produced a given version.
+    void onEdgeInserted(const VertexId_t source, const VertexId_t destination, const size_t weight, const size_t newVersion);
+
+    //  @brief      Drops the trees using the edge `source -> destination`, of which the removal produced a given version.
+    void onEdgeRemoved(const VertexId_t source, const VertexId_t destination, const size_t newVersion);
+
+    //  @brief      Drops the trees reaching the vertex of a given id, of which the removal produced a given version.
+    void onVertexRemoved(const VertexId_t id, const size_t newVersion);
+
+    //  @brief      Follows the version produced by the insertion of a vertex, which no tree reaches.
+    void onVertexInserted(const size_t newVersion);
+
+    //  @brief      Drops every tree, keeping the counters.
+    void clear(void);
+
+    //  @brief      Gets the counters of the cache, with its current number of entries and bytes.
+    GraphWD::CacheCounters getCounters(void) const;
+};
+
+#endif // __SHORTEST_PATH_CACHE_HPP_
@@ -0,0 +1,331 @@
+/*
+    @headerfile     StoragePolicies.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the storage policies of the edges of a `BasicGraphWD`, selected at compile time.
+    @details        A policy provides `template <typename WeightT> class Adjacency`, storing one list of edges per vertex id, constructible from
+    @details        the `std::pmr::memory_resource` from which its lists allocate, with the methods
+    @details        `resize(idBound)`, `insert(source, destination, weight)` and `erase(source, destination)` returning whether they changed the list,
+    @details        `find(source, destination)` returning a pointer to the weight or `nullptr`, `getDegree(source)`, `clear(source)`,
+    @details        and `forEach(source, visitor)` calling the visitor following the convention of `GraphKernels.hpp`.
+    @details        - `MapStorage` stores ordered maps: O(log(degree)) updates, or amortized O(1) in increasing id order, with a node allocation per edge.
+    @details        - `SortedVectorStorage` stores sorted arrays of ids and of weights: O(degree) updates, contiguous scans, and
+    @details          `sizeof(VertexId_t) + sizeof(WeightT)` bytes per edge.
+    @details        - `HashMapStorage` stores hash maps: O(1) expected updates, visited in an unspecified order.
+    @details        - `CsrStorage` stores compressed sparse rows: the most compact and fastest to scan, but O(order + size) updates,
+    @details          for graphs built once and queried often.
+*/
+
+#ifndef __STORAGE_POLICIES_HPP_
+#define __STORAGE_POLICIES_HPP_
+
+#include <map>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <unordered_map>
+#include <memory_resource>
+#include "GraphWDTypes.hpp"
+#include "GraphKernels.hpp"
+
+/*
+    @struct     MapStorage
+    @brief      Stores the edges of every vertex in an ordered map, as `GraphWD` does, visited in increasing id order.
+    @note       Insertions are hinted at the end of the map, so that edges inserted in increasing id order, e.g. by `GraphWD::Builder`,
+    @note       cost amortized constant time.
+*/
+struct MapStorage
+{
+    template <typename WeightT>
+    class Adjacency final
+    {
+    private:
+        std::pmr::vector<std::pmr::map<VertexId_t, WeightT>> lists;
+
+    public:
+        explicit Adjacency(std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+            : lists(resource)
+        {
+        }
+
+        void resize(const VertexId_t idBound)
+        {
+            this->lists.resize(idBound);
+        }
+
+        bool insert(const VertexId_t source, const VertexId_t destination, const WeightT weight)
+        {
+            std::pmr::map<VertexId_t, WeightT>& list = this->lists[source];
+            const size_t degree = list.size();
+            list.try_emplace(list.end(), destination, weight);
+            return list.size() != degree;
+        }
+
+        bool erase(const VertexId_t source, const VertexId_t destination)
+        {
+            return this->lists[source].erase(destination) != 0;
+        }
+
+        const WeightT* find(const VertexId_t source, const VertexId_t destination) const
+        {
+            const auto itEdge = this->lists[source].find(destination);
+            return itEdge != this->lists[source].end() ? &itEdge->second : nullptr;
+        }
+
+        size_t getDegree(const VertexId_t source) const noexcept
+        {
+            return this->lists[source].size();
+        }
+
+        void clear(const VertexId_t source) noexcept
+        {
+            this->lists[source].clear();
+        }
+
+        template <typename Visitor>
+        void forEach(const VertexId_t source, Visitor&& visitor) const
+        {
+            for (const auto& [destination, weight] : this->lists[source])
+                if (!GraphKernels::visitEdge(visitor, destination, weight))
+                    return;
+        }
+    };
+};
+
+/*
+    @struct     SortedVectorStorage
+    @brief      Stores the edges of every vertex in two parallel arrays of ids and weights sorted by id, visited in increasing id order.
+*/
+struct SortedVectorStorage
+{
+    template <typename WeightT>
+    class Adjacency final
+    {
+    private:
+        std::pmr::vector<std::pmr::vector<VertexId_t>> ids;
+        std::pmr::vector<std::pmr::vector<WeightT>> weights;
+
+    public:
+        explicit Adjacency(std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+            : ids(resource), weights(resource)
+        {
+        }
+
+        void resize(const VertexId_t idBound)
+        {
+            this->ids.resize(idBound);
+            this->weights.resize(idBound);
+        }
+
+        bool insert(const VertexId_t source, const VertexId_t destination, const WeightT weight)
+        {
+            std::pmr::vector<VertexId_t>& neighbors = this->ids[source];
+            const auto itId = std::lower_bound(neighbors.begin(), neighbors.end(), destination);
+            if (itId != neighbors.end() && *itId == destination)
+                return false;
+            const std::ptrdiff_t position = itId - neighbors.begin();
+            neighbors.insert(itId, destination);
+            this->weights[source].insert(this->weights[source].begin() + position, weight);
+            return true;
+        }
+
+        bool erase(const VertexId_t source, const VertexId_t destination)
+        {
+            std::pmr::vector<VertexId_t>& neighbors = this->ids[source];
+            const auto itId = std::lower_bound(neighbors.begin(), neighbors.end(), destination);
+            if (itId == neighbors.end() || *itId != destination)
+                return false;
+            const std::ptrdiff_t position = itId - neighbors.begin();
+            neighbors.erase(itId);
+            this->weights[source].erase(this->weights[source].begin() + position);
+            return true;
+        }
+
+        const WeightT* find(const VertexId_t source, const VertexId_t destination) const
+        {
+            const std::pmr::vector<VertexId_t>& neighbors = this->ids[source];
+            const auto itId = std::lower_bound(neighbors.begin(), neighbors.end(), destination);
+            if (itId == neighbors.end() || *itId != destination)
+                return nullptr;
+            return &this->weights[source][static_cast<size_t>(itId - neighbors.begin())];
+        }
+
+        size_t getDegree(const VertexId_t source) const noexcept
+        {
+            return this->ids[source].size();
+        }
+
+        void clear(const VertexId_t source) noexcept
+        {
+            std::pmr::memory_resource* const resource = this->ids.get_allocator().resource();
+            this->ids[source] = std::pmr::vector<VertexId_t>(resource);
+            this->weights[source] = std::pmr::vector<WeightT>(resource);
+        }
+
+        template <typename Visitor>
+        void forEach(const VertexId_t source, Visitor&& visitor) const
+        {
+            const std::pmr::vector<VertexId_t>& neighbors = this->ids[source];
+            const std::pmr::vector<WeightT>& neighborWeights = this->weights[source];
+            for (size_t index = 0; index < neighbors.size(); ++index)
+                if (!GraphKernels::visitEdge(visitor, neighbors[index], neighborWeights[index]))
+                    return;
+        }
+    };
+};
+
+/*
+    @struct     HashMapStorage
+    @brief      Stores the edges of every vertex in a hash map, visited in an unspecified order.
+*/
+struct HashMapStorage
+{
+    template <typename WeightT>
+    class Adjacency final
+    {
+    private:
+        std::pmr::vector<std::pmr::unordered_map<VertexId_t, WeightT>> lists;
+
+    public:
+        explicit Adjacency(std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+            : lists(resource)
+        {
+        }
+
+        void resize(const VertexId_t idBound)
+        {
+            this->lists.resize(idBound);
+        }
+
+        bool insert(const VertexId_t source, const VertexId_t destination, const WeightT weight)
+        {
+            return this->lists[source].try_emplace(destination, weight).second;
+        }
+
+        bool erase(const VertexId_t source, const VertexId_t destination)
+        {
+            return this->lists[source].erase(destination) != 0;
+        }
+
+        const WeightT* find(const VertexId_t source, const VertexId_t destination) const
+        {
+            const auto itEdge = this->lists[source].find(destination);
+            return itEdge != this->lists[source].end() ? &itEdge->second : nullptr;
+        }
+
+        size_t getDegree(const VertexId_t source) const noexcept
+        {
+            return this->lists[source].size();
+        }
+
+        void clear(const VertexId_t source) noexcept
+        {
+            this->lists[source] = std::pmr::unordered_map<VertexId_t, WeightT>(this->lists.get_allocator().resource());
+        }
+
+        template <typename Visitor>
+        void forEach(const VertexId_t source, Visitor&& visitor) const
+        {
+            for (const auto& [destination, weight] : this->lists[source])
+                if (!GraphKernels::visitEdge(visitor, destination, weight))
+                    return;
+        }
+    };
+};
+
+/*
+    @struct     CsrStorage
+    @brief      Stores the edges of all vertices in two arrays of ids and weights, sorted by source then by id, delimited by an array of offsets.
+    @note       Every update shifts the edges and offsets after it, in O(order + size).
+*/
+struct CsrStorage
+{
+    template <typename WeightT>
+    class Adjacency final
+    {
+    private:
+        std::pmr::vector<size_t> offsets;
+        std::pmr::vector<VertexId_t> ids;
+        std::pmr::vector<WeightT> weights;
+
+        //  @brief      Shifts the offsets of the vertices after a given source by a given number of edges.
+        void shiftOffsets(const VertexId_t source, const std::ptrdiff_t count) noexcept
+        {
+            for (size_t index = size_t(source) + 1; index < this->offsets.size(); ++index)
+                this->offsets[index] = static_cast<size_t>(static_cast<std::ptrdiff_t>(this->offsets[index]) + count);
+        }
+
+        //  @brief      Finds the position of the edge `source -> destination`, or of its insertion, and whether it exists.
+        std::pair<size_t, bool> locate(const VertexId_t source, const VertexId_t destination) const
+        {
+            const auto itBegin = this->ids.begin() + static_cast<std::ptrdiff_t>(this->offsets[source]);
+            const auto itEnd = this->ids.begin() + static_cast<std::ptrdiff_t>(this->offsets[size_t(source) + 1]);
+            const auto itId = std::lower_bound(itBegin, itEnd, destination);
+            return { static_cast<size_t>(itId - this->ids.begin()), itId != itEnd && *itId == destination };
+        }
+
+    public:
+        explicit Adjacency(std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+            : offsets(1, 0, resource), ids(resource), weights(resource)
+        {
+        }
+
+        void resize(const VertexId_t idBound)
+        {
+            this->offsets.resize(size_t(idBound) + 1, this->offsets.back());
+        }
+
+        bool insert(const VertexId_t source, const VertexId_t destination, const WeightT weight)
+        {
+            const auto [position, isFound] = this->locate(source, destination);
+            if (isFound)
+                return false;
+            this->ids.insert(this->ids.begin() + static_cast<std::ptrdiff_t>(position), destination);
+            this->weights.insert(this->weights.begin() + static_cast<std::ptrdiff_t>(position), weight);
+            this->shiftOffsets(source, 1);
+            return true;
+        }
+
+        bool erase(const VertexId_t source, const VertexId_t destination)
+        {
+            const auto [position, isFound] = this->locate(source, destination);
+            if (!isFound)
+                return false;
+            this->ids.erase(this->ids.begin() + static_cast<std::ptrdiff_t>(position));
+            this->weights.erase(this->weights.begin() + static_cast<std::ptrdiff_t>(position));
+            this->shiftOffsets(source, -1);
+            return true;
+        }
+
+        const WeightT* find(const VertexId_t source, const VertexId_t destination) const
+        {
+            const auto [position, isFound] = this->locate(source, destination);
+            return isFound ? &this->weights[position] : nullptr;
+        }
+
+        size_t getDegree(const VertexId_t source) const noexcept
+        {
+            return this->offsets[size_t(source) + 1] - this->offsets[source];
+        }
+
+        void clear(const VertexId_t source)
+        {
+            const auto first = static_cast<std::ptrdiff_t>(this->offsets[source]);
+            const auto last = static_cast<std::ptrdiff_t>(this->offsets[size_t(source) + 1]);
+            this->ids.erase(this->ids.begin() + first, this->ids.begin() + last);
+            this->weights.erase(this->weights.begin() + first, this->weights.begin() + last);
+            this->shiftOffsets(source, first - last);
+        }
+
+        template <typename Visitor>
+        void forEach(const VertexId_t source, Visitor&& visitor) const
+        {
+            for (size_t index = this->offsets[source]; index < this->offsets[size_t(source) + 1]; ++index)
+                if (!GraphKernels::visitEdge(visitor, this->ids[index], this->weights[index]))
+                    return;
+        }
+    };
+};
+
+#endif // __STORAGE_POLICIES_HPP_
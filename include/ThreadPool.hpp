@@ -0,0 +1,187 @@
+/*
+    @headerfile     ThreadPool.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the thread pool running the parallel algorithms of `GraphWD`.
+    @details        Every worker owns a mutex-guarded deque of tasks: it pops its own tasks from the back, and takes tasks from the front of
+    @details        the others' deques when its own is empty, so that uneven tasks (e.g. searches from different sources) stay balanced.
+    @details        Submitting a task locks the deque receiving it, and finishing a task locks the group of its `parallelFor` call:
+    @details        no lock is shared by all workers, and idle workers sleep on a semaphore counting the queued tasks.
+    @details        Pools are long-lived: `ThreadPool::getShared` starts one pool per thread count on first use, shared by every later call.
+*/
+
+#ifndef __THREAD_POOL_HPP_
+#define __THREAD_POOL_HPP_
+
+#include <deque>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <exception>
+#include <semaphore>
+#include <functional>
+#include <condition_variable>
+
+/*
+    @class      ThreadPool
+    @brief      Runs tasks on a fixed set of worker threads, each with its own deque, taking tasks from the other deques when idle.
+    @note       Several threads may call `parallelFor` on the same pool concurrently, including its own tasks: a worker waiting
+    @note       for the tasks of a nested call runs queued tasks meanwhile, so that nested calls never leave the pool without a free worker.
+*/
+class ThreadPool final
+{
+private:
+    //  @struct     Worker
+    //  @brief      The task deque owned by one worker thread.
+    struct Worker
+    {
+        std::deque<std::function<void(void)>> tasks;
+        std::mutex mutex;
+    };
+
+    //  @struct     TaskGroup
+    //  @brief      The tasks of one `parallelFor` call, of which the caller waits for the completion and receives the first exception.
+    struct TaskGroup
+    {
+        size_t pendingTasks = 0;
+        std::exception_ptr firstException;
+        std::mutex mutex;
+        std::condition_variable tasksFinished;
+
+        //  @brief      Marks a given number of tasks of the group as finished, keeping a given exception if it is the first one.
+        void finish(std::exception_ptr exception, const size_t count = 1) noexcept;
+
+        //  @brief      Checks whether every task of the group is finished.
+        bool isFinished(void) noexcept;
+
+        //  @brief      Waits until every task of the group is finished, then rethrows the first exception thrown by a task, if any.
+        void wait(void);
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    std::counting_semaphore<> queuedTasks{ 0 };
+    std::atomic<size_t> nextWorker{ 0 };
+    std::atomic<bool> stopping{ false };
+
+    /*
+        @brief      Pops a task from the deque of a given worker, or takes one from the other workers.
+        @param      index The index of the worker looking for a task.
+        @param      task The popped task, if any.
+        @returns    `true` if a task was found, `false` otherwise.
+        @note       A worker only looks for a task after acquiring one of the queued tasks, so that it eventually finds one.
+    */
+    bool findTask(const size_t index, std::function<void(void)>& task);
+
+    /*
+        @brief      Runs the loop of a given worker thread until the pool is destroyed.
+        @param      index The index of the worker.
+    */
+    void runWorker(const size_t index);
+
+    /*
+        @brief      Waits for the tasks of a given group, running queued tasks meanwhile if the caller is a worker of the pool.
+        @param      group The group of which the tasks are waited for.
+        @throws     The first exception thrown by a task of the group, once every task of the group is finished.
+        @note       The worker only blocks once no task is left unclaimed: the remaining tasks of its group are then being run, or about
+        @note       to be, by workers that will finish them, possibly helping with nested calls of their own in the same way.
+    */
+    void wait(TaskGroup& group);
+
+    //  @brief      Wakes the started worker threads so that they exit, then joins them.
+    void stop(void) noexcept;
+
+    /*
+        @brief      Queues a given task, on the deque of the calling worker, or round-robin if the caller is not a worker of the pool.
+        @param      task The task to be run, which must not throw.
+    */
+    void submit(std::function<void(void)> task);
+
+public:
+    /*
+        @brief      Starts a given number of worker threads.
+        @param      threadCount The number of worker threads, or zero for the number of hardware threads.
+    */
+    explicit ThreadPool(const unsigned threadCount);
+
+    //  @brief      Stops and joins the worker threads. No `parallelFor` call may be running.
+    ~ThreadPool(void);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /*
+        @brief      Gets the shared thread pool of a given number of threads, unless a single thread would do.
+        @param      threadCount The number of worker threads, or zero for the number of hardware threads.
+        @param      taskCount The number of tasks to be run: if it is at most one, the tasks run on the calling thread.
+        @returns    `ThreadPool*` The pool, started on the first request of its thread count and alive until the program exits,
+        @returns    or `nullptr` if the tasks should run on the calling thread.
+        @throws     `std::system_error` If the worker threads of a new pool cannot be started.
+    */
+    static ThreadPool* getShared(const unsigned threadCount, const size_t taskCount = SIZE_MAX);
+
+    /*
+        @brief      Gets the number of worker threads of the pool.
+        @returns    `size_t` The number of worker threads.
+    */
+    size_t getThreadCount(void) const noexcept;
+
+    /*
+        @brief      Gets the index of the worker thread calling this method.
+        @returns    `size_t` The index of the calling worker in `[0, getThreadCount())`, or `getThreadCount()` if the caller is not a worker of this pool.
+    */
+    size_t getCurrentWorker(void) const noexcept;
+
+    /*
+        @brief      Calls a given function on every index of a range, in parallel chunks, and waits for all of them.
+        @param      begin The first index of the range.
+        @param      end The index past the last index of the range.
+        @param      grain The number of consecutive indices run by each task.
+        @param      function The callable invoked as `function(index)`.
+        @throws     The first exception thrown by `function`, once every chunk is finished.
+    */
+    template <typename Function>
+    void parallelFor(const size_t begin, const size_t end, const size_t grain, Function&& function)
+    {
+        if (begin >= end)
+            return;
+        const size_t step = grain == 0 ? 1 : grain;
+        TaskGroup group;
+        const size_t taskCount = (end - begin + step - 1) / step;
+        group.pendingTasks = taskCount;
+        size_t submittedTasks = 0;
+        try
+        {
+            for (size_t first = begin; first < end; first += step, ++submittedTasks)
+            {
+                const size_t last = end - first < step ? end : first + step;
+                this->submit([first, last, &function, &group](void)
+                    {
+                        std::exception_ptr exception;
+                        try
+                        {
+                            for (size_t index = first; index < last; ++index)
+                                function(index);
+                        }
+                        catch (...)
+                        {
+                            exception = std::current_exception();
+                        }
+                        group.finish(exception);
+                    });
+            }
+        }
+        catch (...)
+        {
+            group.finish(std::current_exception(), taskCount - submittedTasks);
+        }
+        this->wait(group);
+    }
+};
+
+#endif // __THREAD_POOL_HPP_
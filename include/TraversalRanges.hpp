@@ -0,0 +1,170 @@
+/*
+    @headerfile     TraversalRanges.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines lazy depth-first and breadth-first traversal ranges, running on any graph providing the interface described in `GraphKernels.hpp`.
+    @details        A range yields one `TraversalStep` per visited vertex, and only scans the outgoing edges of a vertex when advancing past it,
+    @details        so that a caller stopping after `k` vertices only pays for the edges of those `k` vertices.
+    @details        Ranges are input views: they can be iterated once, and piped through `std::views` such as `filter` and `take`.
+    @note           A range reads its graph while it is iterated: the graph must outlive the range and must not be modified in the meantime.
+*/
+
+#ifndef __TRAVERSAL_RANGES_HPP_
+#define __TRAVERSAL_RANGES_HPP_
+
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include "GraphWDTypes.hpp"
+
+//  @struct     TraversalStep
+//  @brief      A vertex visited by a traversal, with its depth in the traversal tree and its parent, which is the starting vertex itself for the starting vertex.
+struct TraversalStep
+{
+    VertexId_t id;
+    size_t depth;
+    VertexId_t parent;
+};
+
+namespace GraphKernels
+{
+    /*
+        @class      TraversalRange
+        @brief      Lazily traverses a graph from a starting vertex, in the order of `GraphKernels::dfs` or `GraphKernels::bfs`.
+        @tparam     Graph The type of the traversed graph.
+        @tparam     IsDepthFirst Whether the traversal is depth-first, or breadth-first otherwise.
+        @note       `GraphKernels::DfsRange<Graph>` and `GraphKernels::BfsRange<Graph>` name both traversals.
+    */
+    template <typename Graph, bool IsDepthFirst>
+    class TraversalRange final : public std::ranges::view_interface<TraversalRange<Graph, IsDepthFirst>>
+    {
+    private:
+        //  @brief      The number of consumed entries of a breadth-first queue above which they are discarded.
+        static constexpr size_t QUEUE_COMPACTION_THRESHOLD = 4096;
+
+        const Graph* graph = nullptr;
+        std::vector<bool> visited;
+        std::vector<TraversalStep> frontier;
+        size_t head = 0;
+        TraversalStep current{};
+        bool isDone = true;
+
+        //  @brief      Discovers the unvisited neighbors of the current vertex, and moves to the next vertex of the traversal.
+        void advance(void)
+        {
+            this->graph->forEachNeighbor(this->current.id, [this](const VertexId_t neighbor, const size_t)
+                {
+                    if (this->visited[neighbor])
+                        return;
+                    this->visited[neighbor] = true;
+                    this->frontier.push_back({ neighbor, this->current.depth + 1, this->current.id });
+                });
+            if constexpr (IsDepthFirst)
+            {
+                if (this->frontier.empty())
+                {
+                    this->isDone = true;
+                    return;
+                }
+                this->current = this->frontier.back();
+                this->frontier.pop_back();
+            }
+            else
+            {
+                if (this->head == this->frontier.size())
+                {
+                    this->isDone = true;
+                    return;
+                }
+                this->current = this->frontier[this->head++];
+                if (this->head >= QUEUE_COMPACTION_THRESHOLD && 2 * this->head >= this->frontier.size())
+                {
+                    this->frontier.erase(this->frontier.begin(), this->frontier.begin() + static_cast<std::ptrdiff_t>(this->head));
+                    this->head = 0;
+                }
+            }
+        }
+
+    public:
+        //  @class      Iterator
+        //  @brief      The input iterator of the range, advancing the traversal of the range it belongs to.
+        class Iterator final
+        {
+        private:
+            TraversalRange* range = nullptr;
+
+        public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type = TraversalStep;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator(void) noexcept = default;
+
+            explicit Iterator(TraversalRange* range) noexcept : range(range) {}
+
+            const TraversalStep& operator*(void) const noexcept
+            {
+                return this->range->current;
+            }
+
+            const TraversalStep* operator->(void) const noexcept
+            {
+                return &this->range->current;
+            }
+
+            Iterator& operator++(void)
+            {
+                this->range->advance();
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                this->range->advance();
+            }
+
+            bool operator==(std::default_sentinel_t) const noexcept
+            {
+                return this->range->isDone;
+            }
+        };
+
+        TraversalRange(void) noexcept = default;
+
+        /*
+            @brief      Prepares the traversal of a given graph from a given starting vertex, without visiting any edge yet.
+            @param      graph The graph to be traversed, which must outlive the range.
+            @param      start The id of the starting vertex. It must exist in the graph.
+        */
+        TraversalRange(const Graph& graph, const VertexId_t start)
+            : graph(&graph), visited(graph.getIdBound(), false), current{ start, 0, start }, isDone(false)
+        {
+            this->visited[start] = true;
+        }
+
+        //  @brief      Gets the iterator at the current vertex of the traversal, which is the starting vertex until the range is advanced.
+        Iterator begin(void)
+        {
+            return Iterator(this);
+        }
+
+        std::default_sentinel_t end(void) const noexcept
+        {
+            return std::default_sentinel;
+        }
+    };
+
+    //  @typedef    DfsRange
+    //  @brief      The lazy depth-first traversal of a graph of a given type.
+    template <typename Graph>
+    using DfsRange = TraversalRange<Graph, true>;
+
+    //  @typedef    BfsRange
+    //  @brief      The lazy breadth-first traversal of a graph of a given type.
+    template <typename Graph>
+    using BfsRange = TraversalRange<Graph, false>;
+}
+
+#endif // __TRAVERSAL_RANGES_HPP_
@@ -3,81 +3,147 @@
     @version        1.0
     @author         Ahmad Mzayek
     @date           Thursday, July 18th, 2024
-    @brief          Implements well-known algorithms methods defined in the class `GraphWD`.
+    @brief          Implements the shortest paths methods of the class `GraphWD` reading its shortest path cache or its landmarks.
 */
 
-#include <queue>
-#include <stdexcept>
-#include <unordered_map>
 #include "GraphWD.hpp"
-#include "TextColors.hpp"
+#include "GraphWDStats.hpp"
+#include "DijkstraEngine.hpp"
+#include "LandmarkIndex.hpp"
+#include "ShortestPathCache.hpp"
 
-std::map<Vertex_t, size_t> GraphWD::getDijkstraShortestPaths(const Vertex_t& source) const
+namespace
 {
-    if (this->adjacencyList.find(source) == this->adjacencyList.end())
-        throw std::runtime_error(RED_BOLD "Starting vertex `" + source + "` does not exist in the graph.\n" DEFAULT_COLOR);
-    auto compare = [](const std::pair<Vertex_t, size_t>& a, const std::pair<Vertex_t, size_t>& b) -> bool
-        {
-            return a.second > b.second;
-        };
-    std::priority_queue<
-        std::pair<Vertex_t, size_t>,
-        std::vector<std::pair<Vertex_t, size_t>>,
-        decltype(compare)
-    > minHeap(compare);
-    std::map<Vertex_t, size_t> minDistances;
-    for (const auto& vertex : this->adjacencyList)
-        minDistances[vertex.first] = SIZE_MAX;
-    minDistances[source] = 0;
-    minHeap.push({ source, 0 });
-    while (!minHeap.empty())
+    /*
+        @brief      Copies the shortest path tree found by the last query of a given engine.
+        @param      engine The engine, of which the last query ran to completion.
+        @param      idBound The id bound of the graph searched by the query.
+        @returns    `std::shared_ptr<const ShortestPathCache::Tree>` The tree, to be cached.
+    */
+    template <typename Engine>
+    std::shared_ptr<const ShortestPathCache::Tree> copyShortestPathTree(const Engine& engine, const VertexId_t idBound)
     {
-        const auto [current, currentDistance] = minHeap.top();
-        minHeap.pop();
-        if (currentDistance > minDistances[current])
-            continue;
-        const auto& neighbors = this->adjacencyList.at(current);
-        for (const auto& [neighbor, weight] : neighbors)
+        auto tree = std::make_shared<ShortestPathCache::Tree>();
+        tree->distances.assign(idBound, SIZE_MAX);
+        tree->predecessors.assign(idBound, 0);
+        for (const VertexId_t vertex : engine.getSettled())
         {
-            const size_t newDistance = currentDistance + weight;
-            if (newDistance >= minDistances[neighbor])
-                continue;
-            minDistances[neighbor] = newDistance;
-            minHeap.push({ neighbor, newDistance });
+            tree->distances[vertex] = engine.getDistance(vertex);
+            tree->predecessors[vertex] = engine.getPredecessor(vertex);
         }
+        return tree;
+    }
+}
+
+std::map<Vertex_t, size_t> GraphWD::getDijkstraShortestPaths(const Vertex_t& source) const
+{
+    GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getDijkstraShortestPaths", this->getMemoryResource());)
+    const VertexId_t sourceId = this->getExistingId(source, "Starting vertex");
+    ShortestPathCache* const cache = this->shortestPathCache.cache.get();
+    std::map<Vertex_t, size_t> reachable;
+    if (const auto tree = cache != nullptr ? cache->find(sourceId, this->version) : nullptr)
+    {
+        for (VertexId_t vertex = 0; vertex < tree->distances.size(); ++vertex)
+            if (tree->distances[vertex] != SIZE_MAX)
+                reachable.emplace(this->vertexNames[vertex], tree->distances[vertex]);
+        return reachable;
     }
-    for (auto itMap = minDistances.begin(); itMap != minDistances.end(); )
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, sourceId);
+    if (cache != nullptr)
+        cache->insert(sourceId, this->version, copyShortestPathTree(engine, this->getIdBound()));
+    for (const VertexId_t vertex : engine.getSettled())
+        reachable.emplace(this->vertexNames[vertex], engine.getDistance(vertex));
+    return reachable;
+}
+
+std::vector<size_t> GraphWD::getDijkstraShortestPaths(const VertexId_t source) const
+{
+    GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getDijkstraShortestPaths", this->getMemoryResource());)
+    this->validateId(source, "Starting vertex");
+    ShortestPathCache* const cache = this->shortestPathCache.cache.get();
+    if (const auto tree = cache != nullptr ? cache->find(source, this->version) : nullptr)
     {
-        if (itMap->second == SIZE_MAX)
-            itMap = minDistances.erase(itMap);
-        else
-            ++itMap;
+        std::vector<size_t> minDistances(tree->distances);
+        minDistances.resize(this->getIdBound(), SIZE_MAX);
+        return minDistances;
     }
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, source);
+    if (cache != nullptr)
+        cache->insert(source, this->version, copyShortestPathTree(engine, this->getIdBound()));
+    std::vector<size_t> minDistances(this->getIdBound(), SIZE_MAX);
+    for (const VertexId_t vertex : engine.getSettled())
+        minDistances[vertex] = engine.getDistance(vertex);
     return minDistances;
 }
 
-std::pair<bool, std::vector<Vertex_t>> GraphWD::getKahnTopologicalSort(void) const noexcept
+std::map<Vertex_t, size_t> GraphWD::getDijkstraShortestPaths(const Vertex_t& source, const std::vector<Vertex_t>& targets) const
+{
+    GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getDijkstraShortestPaths", this->getMemoryResource());)
+    const VertexId_t sourceId = this->getExistingId(source, "Starting vertex");
+    std::vector<VertexId_t> targetIds;
+    targetIds.reserve(targets.size());
+    for (const Vertex_t& target : targets)
+        targetIds.push_back(this->getExistingId(target, "Target vertex"));
+    std::map<Vertex_t, size_t> reachable;
+    ShortestPathCache* const cache = this->shortestPathCache.cache.get();
+    if (const auto tree = cache != nullptr ? cache->find(sourceId, this->version) : nullptr)
+    {
+        for (const VertexId_t target : targetIds)
+            if (tree->getDistance(target) != SIZE_MAX)
+                reachable.emplace(this->vertexNames[target], tree->getDistance(target));
+        return reachable;
+    }
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, sourceId, targetIds);
+    for (const VertexId_t target : targetIds)
+        if (engine.isSettled(target))
+            reachable.emplace(this->vertexNames[target], engine.getDistance(target));
+    return reachable;
+}
+
+std::vector<size_t> GraphWD::getDijkstraShortestPaths(const VertexId_t source, const std::vector<VertexId_t>& targets) const
 {
-    std::unordered_map<Vertex_t, size_t> inDegrees;
-    for (const auto& [_, neighbors] : this->adjacencyList)
-        for (const auto& [neighbor, _] : neighbors)
-            ++inDegrees[neighbor];
-    std::queue<Vertex_t> sources;
-    for (const auto& [vertex, _] : this->adjacencyList)
-        if (inDegrees[vertex] == 0)
-            sources.push(vertex);
-    std::vector<Vertex_t> sortedVertices;
-    while (!sources.empty())
+    GRAPH_WD_STATS(const GraphStats::Scope scope(this->statsSink, "getDijkstraShortestPaths", this->getMemoryResource());)
+    this->validateId(source, "Starting vertex");
+    for (const VertexId_t target : targets)
+        this->validateId(target, "Target vertex");
+    std::vector<size_t> minDistances;
+    minDistances.reserve(targets.size());
+    ShortestPathCache* const cache = this->shortestPathCache.cache.get();
+    if (const auto tree = cache != nullptr ? cache->find(source, this->version) : nullptr)
     {
-        const Vertex_t source = sources.front();
-        sources.pop();
-        sortedVertices.push_back(source);
-        const auto& neighbors = this->adjacencyList.at(source);
-        for (const auto& [neighbor, _] : neighbors)
-            if (--inDegrees[neighbor] == 0)
-                sources.push(neighbor);
+        for (const VertexId_t target : targets)
+            minDistances.push_back(tree->getDistance(target));
+        return minDistances;
     }
-    if (sortedVertices.size() != this->getOrder())
-        return { false, {} };
-    return { true, sortedVertices };
-}
\ No newline at end of file
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, source, targets);
+    for (const VertexId_t target : targets)
+        minDistances.push_back(engine.getDistance(target));
+    return minDistances;
+}
+
+std::pair<size_t, std::vector<Vertex_t>> GraphWD::getAStarShortestPath(const Vertex_t& source, const Vertex_t& target) const
+{
+    const VertexId_t sourceId = this->getExistingId(source, "Starting vertex");
+    const VertexId_t targetId = this->getExistingId(target, "Target vertex");
+    const auto [distance, path] = this->getAStarShortestPath(sourceId, targetId);
+    return { distance, this->getVertexNames(path) };
+}
+
+std::pair<size_t, std::vector<VertexId_t>> GraphWD::getAStarShortestPath(const VertexId_t source, const VertexId_t target) const
+{
+    this->validateId(source, "Starting vertex");
+    this->validateId(target, "Target vertex");
+    auto& engine = getThreadLocalDijkstraEngine();
+    if (this->areLandmarksUpToDate())
+        engine.runAStar(*this, source, target, [&index = *this->landmarkIndex, target](const VertexId_t vertex) -> size_t
+            {
+                return index.getLowerBound(vertex, target);
+            });
+    else
+        engine.run(*this, source, { target });
+    return { engine.getDistance(target), engine.getPath(target) };
+}
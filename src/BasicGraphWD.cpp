@@ -0,0 +1,19 @@
+/*
+    @file           BasicGraphWD.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Explicitly instantiates the core of `GraphWD` and the common specializations of the class template `BasicGraphWD` with their cores,
+    @brief          declared `extern` in `GraphWD.hpp` and `BasicGraphWD.hpp`.
+*/
+
+#include "GraphWD.hpp"
+#include "BasicGraphWD.hpp"
+
+template class GraphWDCore<GraphWD, Vertex_t, size_t, MapStorage>;
+
+template class GraphWDCore<BasicGraphWD<VertexId_t, std::uint32_t, SortedVectorStorage>, VertexId_t, std::uint32_t, SortedVectorStorage>;
+template class GraphWDCore<BasicGraphWD<VertexId_t, std::uint16_t, SortedVectorStorage>, VertexId_t, std::uint16_t, SortedVectorStorage>;
+template class GraphWDCore<BasicGraphWD<VertexId_t, std::uint32_t, HashMapStorage>, VertexId_t, std::uint32_t, HashMapStorage>;
+template class GraphWDCore<BasicGraphWD<VertexId_t, std::uint32_t, CsrStorage>, VertexId_t, std::uint32_t, CsrStorage>;
+template class GraphWDCore<BasicGraphWD<Vertex_t, std::uint32_t, SortedVectorStorage>, Vertex_t, std::uint32_t, SortedVectorStorage>;
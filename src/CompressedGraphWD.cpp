@@ -0,0 +1,239 @@
+/*
+    @file           CompressedGraphWD.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the gap-encoded snapshot `CompressedGraphWD`, and the method `GraphWD::compress` producing it.
+*/
+
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include "CompressedGraphWD.hpp"
+#include "DijkstraEngine.hpp"
+#include "TextColors.hpp"
+
+namespace
+{
+    //  @brief      Appends a given value to a given byte stream as a LEB128 varint, 7 bits per byte with the high bit marking continuation.
+    void encodeVarint(std::vector<std::uint8_t>& bytes, std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        bytes.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    //  @brief      Maps a signed difference to an unsigned one, interleaving non-negative and negative values so that small magnitudes stay small.
+    std::uint64_t encodeZigzag(const std::int64_t difference) noexcept
+    {
+        return difference >= 0 ? static_cast<std::uint64_t>(difference) << 1 : ((static_cast<std::uint64_t>(-(difference + 1))) << 1) | 1;
+    }
+}
+
+CompressedGraphWD GraphWD::compress(void) const
+{
+    CompressedGraphWD compressed;
+    compressed.edgeCount = this->getSize();
+    size_t minWeight = SIZE_MAX;
+    size_t maxWeight = 0;
+    for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
+        this->forEachNeighbor(vertex, [&](const VertexId_t, const size_t weight)
+            {
+                minWeight = std::min(minWeight, weight);
+                maxWeight = std::max(maxWeight, weight);
+            });
+    compressed.weightBase = compressed.edgeCount == 0 ? 0 : minWeight;
+    compressed.isUniformlyWeighted = compressed.edgeCount == 0 || minWeight == maxWeight;
+    compressed.nameOffsets.reserve(this->getIdBound() + 1);
+    compressed.nameOffsets.push_back(0);
+    compressed.sortedIds.reserve(this->getOrder());
+    compressed.blockOffsets.reserve((size_t(this->getIdBound()) >> CompressedGraphWD::BLOCK_SHIFT) + 1);
+    compressed.relativeOffsets.reserve(this->getIdBound());
+    compressed.bytes.reserve(this->getIdBound() + (compressed.isUniformlyWeighted ? 1 : 2) * this->getSize());
+    for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
+    {
+        if (this->containsVertex(vertex))
+            compressed.sortedIds.push_back(vertex);
+        compressed.nameChars.insert(compressed.nameChars.end(), this->vertexNames[vertex].begin(), this->vertexNames[vertex].end());
+        compressed.nameOffsets.push_back(compressed.nameChars.size());
+        if ((vertex & ((VertexId_t(1) << CompressedGraphWD::BLOCK_SHIFT) - 1)) == 0)
+            compressed.blockOffsets.push_back(compressed.bytes.size());
+        const size_t relativeOffset = compressed.bytes.size() - compressed.blockOffsets.back();
+        if (relativeOffset > std::numeric_limits<std::uint32_t>::max())
+            throw std::runtime_error(RED_BOLD "The adjacency lists of vertex ids `" + std::to_string(vertex & ~((VertexId_t(1) << CompressedGraphWD::BLOCK_SHIFT) - 1)) + "` onwards are too large to be compressed.\n" DEFAULT_COLOR);
+        compressed.relativeOffsets.push_back(static_cast<std::uint32_t>(relativeOffset));
+        encodeVarint(compressed.bytes, this->outgoing.getDegree(vertex));
+        std::int64_t previous = -1;
+        this->forEachNeighbor(vertex, [&](const VertexId_t neighbor, const size_t weight)
+            {
+                if (previous < 0)
+                    encodeVarint(compressed.bytes, encodeZigzag(static_cast<std::int64_t>(neighbor) - static_cast<std::int64_t>(vertex)));
+                else
+                    encodeVarint(compressed.bytes, static_cast<std::uint64_t>(static_cast<std::int64_t>(neighbor) - previous - 1));
+                if (!compressed.isUniformlyWeighted)
+                    encodeVarint(compressed.bytes, weight - compressed.weightBase);
+                previous = neighbor;
+            });
+    }
+    compressed.bytes.shrink_to_fit();
+    std::sort(compressed.sortedIds.begin(), compressed.sortedIds.end(), [this](const VertexId_t a, const VertexId_t b) -> bool
+        {
+            return this->vertexNames[a] < this->vertexNames[b];
+        });
+    return compressed;
+}
+
+VertexId_t CompressedGraphWD::findVertexId(const Vertex_t& vertex) const noexcept
+{
+    const auto itId = std::lower_bound(this->sortedIds.begin(), this->sortedIds.end(), vertex, [this](const VertexId_t id, const Vertex_t& name) -> bool
+        {
+            return this->getName(id) < name;
+        });
+    if (itId == this->sortedIds.end() || this->getName(*itId) != vertex)
+        return this->getIdBound();
+    return *itId;
+}
+
+VertexId_t CompressedGraphWD::getExistingId(const Vertex_t& vertex, const std::string& role) const
+{
+    const VertexId_t id = this->findVertexId(vertex);
+    if (id == this->getIdBound())
+        throw std::runtime_error(RED_BOLD + role + " `" + vertex + "` does not exist in the compressed graph.\n" DEFAULT_COLOR);
+    return id;
+}
+
+void CompressedGraphWD::validateId(const VertexId_t id, const std::string& role) const
+{
+    if (!this->containsVertex(id))
+        throw std::runtime_error(RED_BOLD + role + " id `" + std::to_string(id) + "` does not exist in the compressed graph.\n" DEFAULT_COLOR);
+}
+
+std::vector<Vertex_t> CompressedGraphWD::getVertexNames(const std::vector<VertexId_t>& ids) const
+{
+    std::vector<Vertex_t> names;
+    names.reserve(ids.size());
+    for (const VertexId_t id : ids)
+        names.emplace_back(this->getName(id));
+    return names;
+}
+
+size_t CompressedGraphWD::getOrder(void) const noexcept
+{
+    return this->sortedIds.size();
+}
+
+size_t CompressedGraphWD::getSize(void) const noexcept
+{
+    return this->edgeCount;
+}
+
+VertexId_t CompressedGraphWD::getIdBound(void) const noexcept
+{
+    return this->nameOffsets.empty() ? 0 : static_cast<VertexId_t>(this->nameOffsets.size() - 1);
+}
+
+size_t CompressedGraphWD::getAdjacencyBytes(void) const noexcept
+{
+    return this->bytes.size() + this->blockOffsets.size() * sizeof(std::uint64_t) + this->relativeOffsets.size() * sizeof(std::uint32_t);
+}
+
+bool CompressedGraphWD::containsVertex(const VertexId_t id) const noexcept
+{
+    return id < this->getIdBound() && this->nameOffsets[id + 1] != this->nameOffsets[id];
+}
+
+VertexId_t CompressedGraphWD::getVertexId(const Vertex_t& vertex) const
+{
+    return this->getExistingId(vertex, "Vertex");
+}
+
+std::string_view CompressedGraphWD::getVertexName(const VertexId_t id) const
+{
+    this->validateId(id, "Vertex");
+    return this->getName(id);
+}
+
+size_t CompressedGraphWD::getOutDegree(const Vertex_t& vertex) const
+{
+    const std::uint8_t* cursor = this->getList(this->getExistingId(vertex, "Vertex"));
+    return CompressedGraphWD::decodeVarint(cursor);
+}
+
+size_t CompressedGraphWD::getOutDegree(const VertexId_t id) const
+{
+    this->validateId(id, "Vertex");
+    const std::uint8_t* cursor = this->getList(id);
+    return CompressedGraphWD::decodeVarint(cursor);
+}
+
+std::vector<Vertex_t> CompressedGraphWD::getDFS(const Vertex_t& startingVertex) const
+{
+    return this->getVertexNames(GraphKernels::dfs(*this, this->getExistingId(startingVertex, "Starting vertex")));
+}
+
+std::vector<VertexId_t> CompressedGraphWD::getDFS(const VertexId_t startingVertex) const
+{
+    this->validateId(startingVertex, "Starting vertex");
+    return GraphKernels::dfs(*this, startingVertex);
+}
+
+std::vector<Vertex_t> CompressedGraphWD::getBFS(const Vertex_t& startingVertex) const
+{
+    return this->getVertexNames(GraphKernels::bfs(*this, this->getExistingId(startingVertex, "Starting vertex")));
+}
+
+std::vector<VertexId_t> CompressedGraphWD::getBFS(const VertexId_t startingVertex) const
+{
+    this->validateId(startingVertex, "Starting vertex");
+    return GraphKernels::bfs(*this, startingVertex);
+}
+
+std::map<Vertex_t, size_t> CompressedGraphWD::getDijkstraShortestPaths(const Vertex_t& source) const
+{
+    const VertexId_t start = this->getExistingId(source, "Starting vertex");
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, start);
+    std::map<Vertex_t, size_t> reachable;
+    for (const VertexId_t vertex : engine.getSettled())
+        reachable.emplace(this->getName(vertex), engine.getDistance(vertex));
+    return reachable;
+}
+
+std::vector<size_t> CompressedGraphWD::getDijkstraShortestPaths(const VertexId_t source) const
+{
+    this->validateId(source, "Starting vertex");
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, source);
+    std::vector<size_t> minDistances(this->getIdBound(), SIZE_MAX);
+    for (const VertexId_t vertex : engine.getSettled())
+        minDistances[vertex] = engine.getDistance(vertex);
+    return minDistances;
+}
+
+std::pair<size_t, std::vector<Vertex_t>> CompressedGraphWD::getDijkstraShortestPath(const Vertex_t& source, const Vertex_t& target) const
+{
+    const VertexId_t start = this->getExistingId(source, "Starting vertex");
+    const VertexId_t end = this->getExistingId(target, "Target vertex");
+    const auto [distance, path] = this->getDijkstraShortestPath(start, end);
+    return { distance, this->getVertexNames(path) };
+}
+
+std::pair<size_t, std::vector<VertexId_t>> CompressedGraphWD::getDijkstraShortestPath(const VertexId_t source, const VertexId_t target) const
+{
+    this->validateId(source, "Starting vertex");
+    this->validateId(target, "Target vertex");
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, source, { target });
+    return { engine.getDistance(target), engine.getPath(target) };
+}
+
+std::pair<bool, std::vector<Vertex_t>> CompressedGraphWD::getKahnTopologicalSort(void) const
+{
+    const auto [sortable, sortedIds] = GraphKernels::kahn(*this);
+    if (!sortable)
+        return { false, {} };
+    return { true, this->getVertexNames(sortedIds) };
+}
@@ -0,0 +1,178 @@
+/*
+    @file           ConcurrentGraphWD.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the methods of the classes `ConcurrentGraphWD` and `ConcurrentGraphWD::Batch`.
+*/
+
+#include "ConcurrentGraphWD.hpp"
+
+void ConcurrentGraphWD::Batch::applyTo(GraphWD& graph) const
+{
+    for (const Operation& operation : this->operations)
+        switch (operation.type)
+        {
+            case Operation::Type::INSERT_VERTEX:
+                graph.insertVertex(operation.source);
+                break;
+            case Operation::Type::REMOVE_VERTEX:
+                graph.removeVertex(operation.source);
+                break;
+            case Operation::Type::INSERT_EDGE:
+                graph.insertEdge(operation.source, operation.destination, operation.weight);
+                break;
+            case Operation::Type::REMOVE_EDGE:
+                graph.removeEdge(operation.source, operation.destination);
+                break;
+        }
+}
+
+ConcurrentGraphWD::Batch& ConcurrentGraphWD::Batch::insertVertex(const Vertex_t& vertex)
+{
+    this->operations.push_back({ Operation::Type::INSERT_VERTEX, vertex, Vertex_t(), 0 });
+    return *this;
+}
+
+ConcurrentGraphWD::Batch& ConcurrentGraphWD::Batch::removeVertex(const Vertex_t& vertex)
+{
+    this->operations.push_back({ Operation::Type::REMOVE_VERTEX, vertex, Vertex_t(), 0 });
+    return *this;
+}
+
+ConcurrentGraphWD::Batch& ConcurrentGraphWD::Batch::insertEdge(const Vertex_t& source, const Vertex_t& destination, const size_t weight)
+{
+    this->operations.push_back({ Operation::Type::INSERT_EDGE, source, destination, weight });
+    return *this;
+}
+
+ConcurrentGraphWD::Batch& ConcurrentGraphWD::Batch::removeEdge(const Vertex_t& source, const Vertex_t& destination)
+{
+    this->operations.push_back({ Operation::Type::REMOVE_EDGE, source, destination, 0 });
+    return *this;
+}
+
+size_t ConcurrentGraphWD::Batch::size(void) const noexcept
+{
+    return this->operations.size();
+}
+
+bool ConcurrentGraphWD::Batch::empty(void) const noexcept
+{
+    return this->operations.empty();
+}
+
+void ConcurrentGraphWD::Batch::clear(void) noexcept
+{
+    this->operations.clear();
+}
+
+ConcurrentGraphWD::Snapshot::Snapshot(Version* const version) noexcept : version(version)
+{
+}
+
+ConcurrentGraphWD::Snapshot::Snapshot(const Snapshot& other) noexcept : version(other.version)
+{
+    // The copied snapshot already pins the version, which therefore cannot be reused meanwhile.
+    if (this->version != nullptr)
+        this->version->pins.fetch_add(1, std::memory_order_relaxed);
+}
+
+ConcurrentGraphWD::Snapshot::Snapshot(Snapshot&& other) noexcept : version(std::exchange(other.version, nullptr))
+{
+}
+
+ConcurrentGraphWD::Snapshot& ConcurrentGraphWD::Snapshot::operator=(Snapshot other) noexcept
+{
+    std::swap(this->version, other.version);
+    return *this;
+}
+
+ConcurrentGraphWD::Snapshot::~Snapshot(void)
+{
+    // Releases the reads of the graph to the writer acquiring the pin count before reusing the version.
+    if (this->version != nullptr)
+        this->version->pins.fetch_sub(1, std::memory_order_release);
+}
+
+const GraphWD& ConcurrentGraphWD::Snapshot::operator*(void) const noexcept
+{
+    return this->version->graph;
+}
+
+const GraphWD* ConcurrentGraphWD::Snapshot::operator->(void) const noexcept
+{
+    return &this->version->graph;
+}
+
+bool ConcurrentGraphWD::Snapshot::operator==(const Snapshot& other) const noexcept
+{
+    return this->version == other.version;
+}
+
+ConcurrentGraphWD::ConcurrentGraphWD(GraphWD graph)
+{
+    this->versions.push_back(std::make_unique<Version>());
+    this->versions.back()->graph = std::move(graph);
+    this->versions.back()->number = 1;
+    this->published.store(this->versions.back().get());
+}
+
+ConcurrentGraphWD::Snapshot ConcurrentGraphWD::getSnapshot(void) const noexcept
+{
+    // The pin and both loads are sequentially consistent, as are the store and the loads of the writer: either the writer observes the pin
+    // before reusing the version, or the version was unpublished before the pin, and the check below sees it.
+    // Versions are never freed before the `ConcurrentGraphWD`, so a pointer to an unpublished version is still valid.
+    Version* version = this->published.load();
+    while (true)
+    {
+        version->pins.fetch_add(1);
+        Version* const latest = this->published.load();
+        if (latest == version)
+            return Snapshot(version);
+        version->pins.fetch_sub(1, std::memory_order_release);
+        version = latest;
+    }
+}
+
+void ConcurrentGraphWD::apply(const Batch& batch)
+{
+    const std::lock_guard<std::mutex> lock(this->writerMutex);
+    Version* const current = this->published.load(std::memory_order_relaxed);
+    // An unpublished version observed unpinned is reached by no reader anymore: the acquire of its pin count orders the reads of the
+    // last reader before the writes below, and later readers unpin it without reading it.
+    Version* target = nullptr;
+    for (const std::unique_ptr<Version>& version : this->versions)
+        if (version.get() != current && version->pins.load() == 0 && (target == nullptr || version->number + 1 == current->number))
+            target = version.get();
+    Batch copy = batch;
+    if (target == nullptr)
+    {
+        this->versions.push_back(std::make_unique<Version>());
+        target = this->versions.back().get();
+    }
+    try
+    {
+        if (target->number != 0 && target->number + 1 == current->number)
+            this->lastBatch.applyTo(target->graph);
+        else
+            target->graph = current->graph;
+        batch.applyTo(target->graph);
+    }
+    catch (...)
+    {
+        target->graph = GraphWD();
+        target->number = 0;
+        throw;
+    }
+    target->number = current->number + 1;
+    this->published.store(target);
+    this->lastBatch = std::move(copy);
+    // Releases the graphs of the versions older than the previous one, which can no longer be replayed into.
+    for (const std::unique_ptr<Version>& version : this->versions)
+        if (version.get() != target && version.get() != current && version->number != 0 && version->pins.load() == 0)
+        {
+            version->graph = GraphWD();
+            version->number = 0;
+        }
+}
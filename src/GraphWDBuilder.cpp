@@ -0,0 +1,336 @@
+/*
+    @file           GraphWDBuilder.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the bulk builder `GraphWD::Builder`, and the methods `GraphWD::loadEdgeList` using it.
+*/
+
+#include <cctype>
+#include <memory>
+#include <fstream>
+#include <iterator>
+#include <charconv>
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+#include "GraphWDBuilder.hpp"
+#include "ThreadPool.hpp"
+#include "TextColors.hpp"
+
+namespace
+{
+    //  @brief      The number of bytes of an edge list parsed by each task, extended to the end of its last line.
+    constexpr size_t CHUNK_BYTES = 1 << 22;
+
+    //  @brief      The number of edges sorted by each thread of `build`, under which sorting is not worth running on several threads.
+    constexpr size_t SORT_EDGES_PER_THREAD = 1 << 18;
+
+    //  @brief      Parses a given field as a weight, which must be a whole non-negative number representable by `size_t`.
+    bool parseWeight(const std::string_view field, size_t& weight) noexcept
+    {
+        const auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), weight);
+        return error == std::errc() && end == field.data() + field.size();
+    }
+
+    //  @struct     Record
+    //  @brief      A parsed line of an edge list, of which the names point into the chunk it was read from.
+    struct Record
+    {
+        std::string_view source;
+        std::string_view destination;
+        size_t weight;
+        bool isEdge;
+    };
+
+    //  @struct     ParsedChunk
+    //  @brief      A chunk of an edge list, with its parsed records and the number of its non-empty and rejected lines.
+    struct ParsedChunk
+    {
+        std::string text;
+        std::vector<Record> records;
+        size_t lines = 0;
+        size_t rejectedLines = 0;
+    };
+
+    //  @brief      Checks whether a given name is a valid vertex, see `GraphWD::isValidVertex`.
+    bool isValidName(const std::string_view name) noexcept
+    {
+        return !name.empty() && std::all_of(name.begin(), name.end(), [](const char character) { return std::isalnum(static_cast<unsigned char>(character)) != 0; });
+    }
+
+    //  @brief      Parses the lines of a given chunk into its records, counting the rejected ones.
+    void parseChunk(ParsedChunk& chunk)
+    {
+        const std::string_view text = chunk.text;
+        size_t position = 0;
+        while (position < text.size())
+        {
+            size_t end = text.find('\n', position);
+            if (end == std::string_view::npos)
+                end = text.size();
+            std::string_view line = text.substr(position, end - position);
+            position = end + 1;
+            std::string_view fields[4];
+            size_t fieldCount = 0;
+            for (size_t index = 0; index < line.size() && fieldCount < 4;)
+            {
+                while (index < line.size() && (line[index] == ' ' || line[index] == '\t' || line[index] == '\r'))
+                    ++index;
+                const size_t first = index;
+                while (index < line.size() && line[index] != ' ' && line[index] != '\t' && line[index] != '\r')
+                    ++index;
+                if (index > first)
+                    fields[fieldCount++] = line.substr(first, index - first);
+            }
+            if (fieldCount == 0 || fields[0].front() == '#' || fields[0].front() == '%')
+                continue;
+            ++chunk.lines;
+            Record record{ fields[0], fields[1], 0, fieldCount == 3 };
+            const bool isValid = (fieldCount == 1 && isValidName(record.source))
+                || (fieldCount == 3 && isValidName(record.source) && isValidName(record.destination)
+                    && parseWeight(fields[2], record.weight));
+            if (isValid)
+                chunk.records.push_back(record);
+            else
+                ++chunk.rejectedLines;
+        }
+    }
+
+    /*
+        @brief      Reads the next chunk of a given stream, cut after the last complete line unless the stream ends.
+        @param      input The stream to be read.
+        @param      carry The beginning of an incomplete line left by the previous chunk, replaced by the one left by this chunk.
+        @param      chunk The chunk receiving the text.
+        @returns    `true` if the chunk is not empty, `false` otherwise.
+    */
+    bool readChunk(std::istream& input, std::string& carry, ParsedChunk& chunk)
+    {
+        chunk.text.swap(carry);
+        carry.clear();
+        const size_t length = chunk.text.size();
+        chunk.text.resize(length + CHUNK_BYTES);
+        input.read(chunk.text.data() + length, static_cast<std::streamsize>(CHUNK_BYTES));
+        chunk.text.resize(length + static_cast<size_t>(input.gcount()));
+        if (input)
+        {
+            const size_t lastLine = chunk.text.rfind('\n');
+            if (lastLine != std::string::npos)
+            {
+                carry.assign(chunk.text, lastLine + 1);
+                chunk.text.resize(lastLine + 1);
+            }
+            else
+                chunk.text.swap(carry);
+        }
+        return !chunk.text.empty() || !carry.empty();
+    }
+}
+
+VertexId_t GraphWD::Builder::intern(const std::string_view vertex)
+{
+    const auto itVertex = this->vertexIds.find(vertex);
+    if (itVertex != this->vertexIds.end())
+        return itVertex->second;
+    const VertexId_t id = static_cast<VertexId_t>(this->vertexNames.size());
+    this->vertexNames.emplace_back(vertex);
+    this->vertexIds.emplace(this->vertexNames.back(), id);
+    return id;
+}
+
+void GraphWD::Builder::appendEdge(const VertexId_t source, const VertexId_t destination, const size_t weight)
+{
+    if (source == destination)
+    {
+        if (this->selfLoopPolicy == SelfLoopPolicy::THROW)
+            throw std::runtime_error(RED_BOLD "Edge from vertex `" + this->vertexNames[source] + "` to itself is a self-loop.\n" DEFAULT_COLOR);
+        ++this->report.selfLoops;
+        return;
+    }
+    this->edges.push_back({ source, destination, weight });
+}
+
+GraphWD::Builder& GraphWD::Builder::setDuplicatePolicy(const DuplicatePolicy policy) noexcept
+{
+    this->duplicatePolicy = policy;
+    return *this;
+}
+
+GraphWD::Builder& GraphWD::Builder::setSelfLoopPolicy(const SelfLoopPolicy policy) noexcept
+{
+    this->selfLoopPolicy = policy;
+    return *this;
+}
+
+GraphWD::Builder& GraphWD::Builder::setThreads(const unsigned threads) noexcept
+{
+    this->threads = threads;
+    return *this;
+}
+
+VertexId_t GraphWD::Builder::addVertex(const Vertex_t& vertex)
+{
+    if (!GraphWD::isValidVertex(vertex))
+        throw std::runtime_error(RED_BOLD "Vertex `" + vertex + "` is not valid.\n" DEFAULT_COLOR);
+    return this->intern(vertex);
+}
+
+void GraphWD::Builder::addEdge(const Vertex_t& source, const Vertex_t& destination, const size_t weight)
+{
+    const VertexId_t sourceId = this->addVertex(source);
+    this->appendEdge(sourceId, this->addVertex(destination), weight);
+}
+
+void GraphWD::Builder::addEdge(const VertexId_t source, const VertexId_t destination, const size_t weight)
+{
+    if (source >= this->vertexNames.size())
+        throw std::runtime_error(RED_BOLD "Source vertex id `" + std::to_string(source) + "` was not added to the builder.\n" DEFAULT_COLOR);
+    if (destination >= this->vertexNames.size())
+        throw std::runtime_error(RED_BOLD "Destination vertex id `" + std::to_string(destination) + "` was not added to the builder.\n" DEFAULT_COLOR);
+    this->appendEdge(source, destination, weight);
+}
+
+GraphWD::Builder& GraphWD::Builder::loadEdgeList(std::istream& input)
+{
+    ThreadPool* const pool = ThreadPool::getShared(this->threads);
+    const size_t batchSize = pool != nullptr ? 2 * pool->getThreadCount() : 1;
+    std::vector<ParsedChunk> batch(batchSize);
+    std::string carry;
+    bool isEnd = false;
+    while (!isEnd)
+    {
+        size_t chunkCount = 0;
+        while (chunkCount < batchSize && readChunk(input, carry, batch[chunkCount]))
+            ++chunkCount;
+        isEnd = chunkCount < batchSize;
+        if (pool != nullptr && chunkCount > 1)
+            pool->parallelFor(0, chunkCount, 1, [&batch](const size_t index) { parseChunk(batch[index]); });
+        else
+            for (size_t index = 0; index < chunkCount; ++index)
+                parseChunk(batch[index]);
+        for (size_t index = 0; index < chunkCount; ++index)
+        {
+            ParsedChunk& chunk = batch[index];
+            this->report.lines += chunk.lines;
+            this->report.rejectedLines += chunk.rejectedLines;
+            for (const Record& record : chunk.records)
+            {
+                const VertexId_t source = this->intern(record.source);
+                if (record.isEdge)
+                    this->appendEdge(source, this->intern(record.destination), record.weight);
+            }
+            chunk.records.clear();
+            chunk.lines = chunk.rejectedLines = 0;
+        }
+    }
+    return *this;
+}
+
+GraphWD::Builder& GraphWD::Builder::loadEdgeList(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        throw std::runtime_error(RED_BOLD "File `" + path + "` cannot be opened.\n" DEFAULT_COLOR);
+    return this->loadEdgeList(file);
+}
+
+const GraphWD::Builder::Report& GraphWD::Builder::getReport(void) const noexcept
+{
+    return this->report;
+}
+
+GraphWD GraphWD::Builder::build(std::pmr::memory_resource* const resource)
+{
+    const auto isBefore = [](const Edge& a, const Edge& b) -> bool
+        {
+            return a.source != b.source ? a.source < b.source : a.destination < b.destination;
+        };
+    ThreadPool* const pool = ThreadPool::getShared(this->threads, this->edges.size() / SORT_EDGES_PER_THREAD);
+    if (pool != nullptr)
+    {
+        const size_t partCount = pool->getThreadCount(), partSize = (this->edges.size() + partCount - 1) / partCount;
+        pool->parallelFor(0, partCount, 1, [&](const size_t part)
+            {
+                const size_t first = std::min(part * partSize, this->edges.size()), last = std::min(first + partSize, this->edges.size());
+                std::stable_sort(this->edges.begin() + first, this->edges.begin() + last, isBefore);
+            });
+        for (size_t width = partSize; width < this->edges.size(); width *= 2)
+            pool->parallelFor(0, (this->edges.size() + 2 * width - 1) / (2 * width), 1, [&](const size_t pair)
+                {
+                    const size_t first = pair * 2 * width, middle = std::min(first + width, this->edges.size());
+                    const size_t last = std::min(middle + width, this->edges.size());
+                    std::inplace_merge(this->edges.begin() + first, this->edges.begin() + middle, this->edges.begin() + last, isBefore);
+                });
+    }
+    else
+        std::stable_sort(this->edges.begin(), this->edges.end(), isBefore);
+
+    if (this->duplicatePolicy == DuplicatePolicy::THROW)
+    {
+        const auto itDuplicate = std::adjacent_find(this->edges.begin(), this->edges.end(), [&isBefore](const Edge& a, const Edge& b) -> bool
+            {
+                return !isBefore(a, b);
+            });
+        if (itDuplicate != this->edges.end())
+            throw std::runtime_error(RED_BOLD "An edge already exists from vertex `" + this->vertexNames[itDuplicate->source]
+                + "` to vertex `" + this->vertexNames[itDuplicate->destination] + "`.\n" DEFAULT_COLOR);
+    }
+    size_t kept = 0;
+    for (size_t index = 0; index < this->edges.size(); ++kept)
+    {
+        Edge edge = this->edges[index];
+        for (++index; index < this->edges.size() && !isBefore(edge, this->edges[index]); ++index)
+        {
+            ++this->report.duplicates;
+            const size_t weight = this->edges[index].weight;
+            switch (this->duplicatePolicy)
+            {
+                case DuplicatePolicy::KEEP_FIRST:
+                    break;
+                case DuplicatePolicy::KEEP_LAST:
+                    edge.weight = weight;
+                    break;
+                case DuplicatePolicy::KEEP_MINIMUM:
+                    edge.weight = std::min(edge.weight, weight);
+                    break;
+                case DuplicatePolicy::KEEP_MAXIMUM:
+                    edge.weight = std::max(edge.weight, weight);
+                    break;
+                case DuplicatePolicy::THROW:
+                    break;
+            }
+        }
+        this->edges[kept] = edge;
+    }
+    this->edges.resize(kept);
+
+    GraphWD graph(resource);
+    graph.vertexIds.reserve(this->vertexNames.size());
+    for (VertexId_t vertex = 0; vertex < this->vertexNames.size(); ++vertex)
+        graph.vertexIds.emplace(this->vertexNames[vertex], vertex);
+    graph.vertexNames.assign(std::make_move_iterator(this->vertexNames.begin()), std::make_move_iterator(this->vertexNames.end()));
+    graph.isPresent.assign(graph.vertexNames.size(), true);
+    graph.order = graph.vertexNames.size();
+    graph.outgoing.resize(graph.getIdBound());
+    graph.incoming.resize(graph.getIdBound());
+    for (const Edge& edge : this->edges)
+    {
+        graph.outgoing.insert(edge.source, edge.destination, edge.weight);
+        graph.incoming.insert(edge.destination, edge.source, edge.weight);
+    }
+    graph.edgeCount = this->edges.size();
+    this->vertexIds.clear();
+    this->vertexNames.clear();
+    this->edges = std::vector<Edge>();
+    return graph;
+}
+
+GraphWD GraphWD::loadEdgeList(std::istream& input)
+{
+    return GraphWD::Builder().loadEdgeList(input).build();
+}
+
+GraphWD GraphWD::loadEdgeList(const std::string& path)
+{
+    return GraphWD::Builder().loadEdgeList(path).build();
+}
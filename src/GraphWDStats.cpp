@@ -0,0 +1,73 @@
+/*
+    @file           GraphWDStats.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the instrumentation defined in `GraphWDStats.hpp`.
+    @details        Allocations are counted by `GraphStats::CountingResource`, which is available whether statistics are enabled or not.
+*/
+
+#include <exception>
+#include "GraphWDStats.hpp"
+
+GraphStats::CountingResource::CountingResource(std::pmr::memory_resource* const upstream) noexcept
+    : upstream(upstream)
+{
+}
+
+size_t GraphStats::CountingResource::getAllocationCount(void) const noexcept
+{
+    return this->allocationCount.load(std::memory_order_relaxed);
+}
+
+void* GraphStats::CountingResource::do_allocate(const size_t bytes, const size_t alignment)
+{
+    void* const pointer = this->upstream->allocate(bytes, alignment);
+    this->allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return pointer;
+}
+
+void GraphStats::CountingResource::do_deallocate(void* const pointer, const size_t bytes, const size_t alignment)
+{
+    this->upstream->deallocate(pointer, bytes, alignment);
+}
+
+bool GraphStats::CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+#ifdef GRAPH_WD_ENABLE_STATS
+namespace
+{
+    thread_local GraphStats::Stats current;
+    thread_local unsigned scopeDepth = 0;
+}
+
+GraphStats::Stats& GraphStats::getCurrent(void) noexcept
+{
+    return current;
+}
+
+GraphStats::Scope::Scope(const Sink& sink, const std::string_view operation, const std::pmr::memory_resource* const resource) noexcept
+    : sink(sink), operation(operation), resource(dynamic_cast<const CountingResource*>(resource)),
+    isOutermost(scopeDepth++ == 0 && sink), uncaughtExceptions(std::uncaught_exceptions())
+{
+    if (!this->isOutermost)
+        return;
+    current = Stats();
+    this->allocations = this->resource != nullptr ? this->resource->getAllocationCount() : 0;
+    this->start = std::chrono::steady_clock::now();
+}
+
+GraphStats::Scope::~Scope()
+{
+    --scopeDepth;
+    if (!this->isOutermost || std::uncaught_exceptions() != this->uncaughtExceptions)
+        return;
+    current.wallTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->start);
+    current.allocations = this->resource != nullptr ? this->resource->getAllocationCount() - this->allocations : 0;
+    current.operation = this->operation;
+    this->sink(current);
+}
+#endif // GRAPH_WD_ENABLE_STATS
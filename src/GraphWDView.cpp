@@ -0,0 +1,269 @@
+/*
+    @file           GraphWDView.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the compressed-sparse-row snapshot `GraphWDView`, and the method `GraphWD::freeze` producing it.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+#include "GraphWDView.hpp"
+#include "GraphKernels.hpp"
+#include "TraversalRanges.hpp"
+#include "DijkstraEngine.hpp"
+#include "TextColors.hpp"
+
+GraphWDView GraphWD::freeze(void) const
+{
+    auto buffers = std::make_shared<GraphWDView::Buffers>();
+    buffers->nameOffsets.reserve(this->getIdBound() + 1);
+    buffers->nameOffsets.push_back(0);
+    buffers->sortedIds.reserve(this->getOrder());
+    buffers->offsets.reserve(this->getIdBound() + 1);
+    buffers->offsets.push_back(0);
+    buffers->targets.reserve(this->getSize());
+    buffers->weights.reserve(this->getSize());
+    for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
+    {
+        if (this->containsVertex(vertex))
+            buffers->sortedIds.push_back(vertex);
+        buffers->nameChars.insert(buffers->nameChars.end(), this->vertexNames[vertex].begin(), this->vertexNames[vertex].end());
+        buffers->nameOffsets.push_back(buffers->nameChars.size());
+        this->forEachNeighbor(vertex, [&](const VertexId_t neighbor, const size_t weight)
+            {
+                buffers->targets.push_back(neighbor);
+                buffers->weights.push_back(weight);
+            });
+        buffers->offsets.push_back(buffers->targets.size());
+    }
+    std::sort(buffers->sortedIds.begin(), buffers->sortedIds.end(), [this](const VertexId_t a, const VertexId_t b) -> bool
+        {
+            return this->vertexNames[a] < this->vertexNames[b];
+        });
+    GraphWDView view;
+    view.nameOffsets = buffers->nameOffsets;
+    view.nameChars = buffers->nameChars;
+    view.sortedIds = buffers->sortedIds;
+    view.offsets = buffers->offsets;
+    view.targets = buffers->targets;
+    view.weights = buffers->weights;
+    view.storage = std::move(buffers);
+    return view;
+}
+
+VertexId_t GraphWDView::findVertexId(const Vertex_t& vertex) const noexcept
+{
+    const auto itId = std::lower_bound(this->sortedIds.begin(), this->sortedIds.end(), vertex, [this](const VertexId_t id, const Vertex_t& name) -> bool
+        {
+            return this->getName(id) < name;
+        });
+    if (itId == this->sortedIds.end() || this->getName(*itId) != vertex)
+        return this->getIdBound();
+    return *itId;
+}
+
+std::vector<Vertex_t> GraphWDView::getVertexNames(const std::vector<VertexId_t>& ids) const
+{
+    std::vector<Vertex_t> names;
+    names.reserve(ids.size());
+    for (const VertexId_t id : ids)
+        names.emplace_back(this->getName(id));
+    return names;
+}
+
+size_t GraphWDView::getOrder(void) const noexcept
+{
+    return this->sortedIds.size();
+}
+
+size_t GraphWDView::getSize(void) const noexcept
+{
+    return this->targets.size();
+}
+
+VertexId_t GraphWDView::getIdBound(void) const noexcept
+{
+    return this->nameOffsets.empty() ? 0 : static_cast<VertexId_t>(this->nameOffsets.size() - 1);
+}
+
+bool GraphWDView::containsVertex(const VertexId_t id) const noexcept
+{
+    return id < this->getIdBound() && this->nameOffsets[id + 1] != this->nameOffsets[id];
+}
+
+VertexId_t GraphWDView::getVertexId(const Vertex_t& vertex) const
+{
+    const VertexId_t id = this->findVertexId(vertex);
+    if (id == this->getIdBound())
+        throw std::runtime_error(RED_BOLD "Vertex `" + vertex + "` does not exist in the view.\n" DEFAULT_COLOR);
+    return id;
+}
+
+std::string_view GraphWDView::getVertexName(const VertexId_t id) const
+{
+    if (!this->containsVertex(id))
+        throw std::runtime_error(RED_BOLD "Vertex id `" + std::to_string(id) + "` does not exist in the view.\n" DEFAULT_COLOR);
+    return this->getName(id);
+}
+
+size_t GraphWDView::getOutDegree(const Vertex_t& vertex) const
+{
+    const VertexId_t id = this->getVertexId(vertex);
+    return this->offsets[id + 1] - this->offsets[id];
+}
+
+std::vector<Vertex_t> GraphWDView::getDFS(const Vertex_t& startingVertex) const
+{
+    const VertexId_t start = this->findVertexId(startingVertex);
+    if (start == this->getIdBound())
+        throw std::runtime_error(RED_BOLD "Starting vertex `" + startingVertex + "` does not exist in the view.\n" DEFAULT_COLOR);
+    return this->getVertexNames(GraphKernels::dfs(*this, start));
+}
+
+std::vector<VertexId_t> GraphWDView::getDFS(const VertexId_t startingVertex) const
+{
+    if (!this->containsVertex(startingVertex))
+        throw std::runtime_error(RED_BOLD "Starting vertex id `" + std::to_string(startingVertex) + "` does not exist in the view.\n" DEFAULT_COLOR);
+    return GraphKernels::dfs(*this, startingVertex);
+}
+
+std::vector<Vertex_t> GraphWDView::getBFS(const Vertex_t& startingVertex) const
+{
+    const VertexId_t start = this->findVertexId(startingVertex);
+    if (start == this->getIdBound())
+        throw std::runtime_error(RED_BOLD "Starting vertex `" + startingVertex + "` does not exist in the view.\n" DEFAULT_COLOR);
+    return this->getVertexNames(GraphKernels::bfs(*this, start));
+}
+
+std::vector<VertexId_t> GraphWDView::getBFS(const VertexId_t startingVertex) const
+{
+    if (!this->containsVertex(startingVertex))
+        throw std::runtime_error(RED_BOLD "Starting vertex id `" + std::to_string(startingVertex) + "` does not exist in the view.\n" DEFAULT_COLOR);
+    return GraphKernels::bfs(*this, startingVertex);
+}
+
+GraphKernels::DfsRange<GraphWDView> GraphWDView::getDFSRange(const Vertex_t& startingVertex) const
+{
+    const VertexId_t start = this->findVertexId(startingVertex);
+    if (start == this->getIdBound())
+        throw std::runtime_error(RED_BOLD "Starting vertex `" + startingVertex + "` does not exist in the view.\n" DEFAULT_COLOR);
+    return GraphKernels::DfsRange<GraphWDView>(*this, start);
+}
+
+GraphKernels::DfsRange<GraphWDView> GraphWDView::getDFSRange(const VertexId_t startingVertex) const
+{
+    if (!this->containsVertex(startingVertex))
+        throw std::runtime_error(RED_BOLD "Starting vertex id `" + std::to_string(startingVertex) + "` does not exist in the view.\n" DEFAULT_COLOR);
+    return GraphKernels::DfsRange<GraphWDView>(*this, startingVertex);
+}
+
+GraphKernels::BfsRange<GraphWDView> GraphWDView::getBFSRange(const Vertex_t& startingVertex) const
+{
+    const VertexId_t start = this->findVertexId(startingVertex);
+    if (start == this->getIdBound())
+        throw std::runtime_error(RED_BOLD "Starting vertex `" + startingVertex + "` does not exist in the view.\n" DEFAULT_COLOR);
+    return GraphKernels::BfsRange<GraphWDView>(*this, start);
+}
+
+GraphKernels::BfsRange<GraphWDView> GraphWDView::getBFSRange(const VertexId_t startingVertex) const
+{
+    if (!this->containsVertex(startingVertex))
+        throw std::runtime_error(RED_BOLD "Starting vertex id `" + std::to_string(startingVertex) + "` does not exist in the view.\n" DEFAULT_COLOR);
+    return GraphKernels::BfsRange<GraphWDView>(*this, startingVertex);
+}
+
+std::map<Vertex_t, size_t> GraphWDView::getDijkstraShortestPaths(const Vertex_t& source) const
+{
+    const VertexId_t start = this->findVertexId(source);
+    if (start == this->getIdBound())
+        throw std::runtime_error(RED_BOLD "Starting vertex `" + source + "` does not exist in the view.\n" DEFAULT_COLOR);
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, start);
+    std::map<Vertex_t, size_t> reachable;
+    for (const VertexId_t vertex : engine.getSettled())
+        reachable.emplace(this->getName(vertex), engine.getDistance(vertex));
+    return reachable;
+}
+
+std::vector<size_t> GraphWDView::getDijkstraShortestPaths(const VertexId_t source) const
+{
+    if (!this->containsVertex(source))
+        throw std::runtime_error(RED_BOLD "Starting vertex id `" + std::to_string(source) + "` does not exist in the view.\n" DEFAULT_COLOR);
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, source);
+    std::vector<size_t> minDistances(this->getIdBound(), SIZE_MAX);
+    for (const VertexId_t vertex : engine.getSettled())
+        minDistances[vertex] = engine.getDistance(vertex);
+    return minDistances;
+}
+
+std::map<Vertex_t, size_t> GraphWDView::getDijkstraShortestPaths(const Vertex_t& source, const std::vector<Vertex_t>& targets) const
+{
+    const VertexId_t start = this->findVertexId(source);
+    if (start == this->getIdBound())
+        throw std::runtime_error(RED_BOLD "Starting vertex `" + source + "` does not exist in the view.\n" DEFAULT_COLOR);
+    std::vector<VertexId_t> targetIds;
+    targetIds.reserve(targets.size());
+    for (const Vertex_t& target : targets)
+    {
+        const VertexId_t targetId = this->findVertexId(target);
+        if (targetId == this->getIdBound())
+            throw std::runtime_error(RED_BOLD "Target vertex `" + target + "` does not exist in the view.\n" DEFAULT_COLOR);
+        targetIds.push_back(targetId);
+    }
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, start, targetIds);
+    std::map<Vertex_t, size_t> reachable;
+    for (const VertexId_t target : targetIds)
+        if (engine.isSettled(target))
+            reachable.emplace(this->getName(target), engine.getDistance(target));
+    return reachable;
+}
+
+std::vector<size_t> GraphWDView::getDijkstraShortestPaths(const VertexId_t source, const std::vector<VertexId_t>& targets) const
+{
+    if (!this->containsVertex(source))
+        throw std::runtime_error(RED_BOLD "Starting vertex id `" + std::to_string(source) + "` does not exist in the view.\n" DEFAULT_COLOR);
+    for (const VertexId_t target : targets)
+        if (!this->containsVertex(target))
+            throw std::runtime_error(RED_BOLD "Target vertex id `" + std::to_string(target) + "` does not exist in the view.\n" DEFAULT_COLOR);
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, source, targets);
+    std::vector<size_t> minDistances;
+    minDistances.reserve(targets.size());
+    for (const VertexId_t target : targets)
+        minDistances.push_back(engine.getDistance(target));
+    return minDistances;
+}
+
+std::pair<size_t, std::vector<Vertex_t>> GraphWDView::getDijkstraShortestPath(const Vertex_t& source, const Vertex_t& target) const
+{
+    const VertexId_t start = this->findVertexId(source);
+    if (start == this->getIdBound())
+        throw std::runtime_error(RED_BOLD "Starting vertex `" + source + "` does not exist in the view.\n" DEFAULT_COLOR);
+    const VertexId_t end = this->findVertexId(target);
+    if (end == this->getIdBound())
+        throw std::runtime_error(RED_BOLD "Target vertex `" + target + "` does not exist in the view.\n" DEFAULT_COLOR);
+    const auto [distance, path] = this->getDijkstraShortestPath(start, end);
+    return { distance, this->getVertexNames(path) };
+}
+
+std::pair<size_t, std::vector<VertexId_t>> GraphWDView::getDijkstraShortestPath(const VertexId_t source, const VertexId_t target) const
+{
+    if (!this->containsVertex(source))
+        throw std::runtime_error(RED_BOLD "Starting vertex id `" + std::to_string(source) + "` does not exist in the view.\n" DEFAULT_COLOR);
+    if (!this->containsVertex(target))
+        throw std::runtime_error(RED_BOLD "Target vertex id `" + std::to_string(target) + "` does not exist in the view.\n" DEFAULT_COLOR);
+    auto& engine = getThreadLocalDijkstraEngine();
+    engine.run(*this, source, { target });
+    return { engine.getDistance(target), engine.getPath(target) };
+}
+
+std::pair<bool, std::vector<Vertex_t>> GraphWDView::getKahnTopologicalSort(void) const noexcept
+{
+    const auto [sortable, sortedIds] = GraphKernels::kahn(*this);
+    if (!sortable)
+        return { false, {} };
+    return { true, this->getVertexNames(sortedIds) };
+}
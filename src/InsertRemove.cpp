@@ -3,57 +3,60 @@
     @version        1.0
     @author         Ahmad Mzayek
     @date           Thursday, July 18th, 2024
-    @brief          Implements methods related to insertion and deletion of vertices and edges into and from the graph, defined in the class `GraphWD`.
+    @brief          Implements the hooks through which the class `GraphWD` follows the insertions and deletions of vertices and edges,
+    @brief          validated and applied by `GraphWDCore`.
 */
 
-#include <stdexcept>
 #include "GraphWD.hpp"
-#include "TextColors.hpp"
+#include "ShortestPathCache.hpp"
 
-void GraphWD::insertVertex(const Vertex_t& vertex)
+void GraphWD::onVertexInserted(const VertexId_t id)
 {
-    if (!GraphWD::isValidVertex(vertex))
-        throw std::runtime_error(RED_BOLD "Vertex `" + vertex + "` is not valid.\n" DEFAULT_COLOR);
-    if (this->adjacencyList.find(vertex) != this->adjacencyList.end())
-        throw std::runtime_error(RED_BOLD "Vertex `" + vertex + "` already exists in the graph.\n" DEFAULT_COLOR);
-    this->adjacencyList[vertex];
+    if (this->maintainsTopologicalOrder)
+    {
+        if (id >= this->topologicalIndices.size())
+        {
+            this->topologicalIndices.resize(id + 1);
+            this->topologicalMarks.resize(id + 1, false);
+        }
+        this->topologicalIndices[id] = this->topologicalOrder.size();
+        this->topologicalOrder.push_back(id);
+    }
+    ++this->version;
+    if (this->shortestPathCache.cache != nullptr)
+        this->shortestPathCache.cache->onVertexInserted(this->version);
 }
 
-void GraphWD::removeVertex(const Vertex_t& vertex)
+void GraphWD::onVertexRemoved(const VertexId_t id)
 {
-    const auto itVertex = this->adjacencyList.find(vertex);
-    if (itVertex == this->adjacencyList.end())
-        throw std::runtime_error(RED_BOLD "Vertex `" + vertex + "` does not exist in the graph.\n" DEFAULT_COLOR);
-    this->adjacencyList.erase(itVertex);
-    for (auto& [_, neighbors] : this->adjacencyList)
-        neighbors.erase(vertex);
+    if (this->maintainsTopologicalOrder)
+    {
+        this->topologicalOrder[this->topologicalIndices[id]] = TOPOLOGICAL_TOMBSTONE;
+        ++this->topologicalTombstones;
+        if (this->topologicalTombstones > this->topologicalOrder.size() - this->topologicalTombstones)
+            this->compactTopologicalOrder();
+    }
+    ++this->version;
+    if (this->shortestPathCache.cache != nullptr)
+        this->shortestPathCache.cache->onVertexRemoved(id, this->version);
 }
 
-void GraphWD::insertEdge(const Vertex_t& source, const Vertex_t& destination, const size_t weight)
+void GraphWD::onEdgeInserting(const VertexId_t source, const VertexId_t destination)
 {
-    auto itSource = this->adjacencyList.find(source);
-    if (itSource == this->adjacencyList.end())
-        throw std::runtime_error(RED_BOLD "Source vertex `" + source + "` does not exist in the graph.\n" DEFAULT_COLOR);
-    if (this->adjacencyList.find(destination) == this->adjacencyList.end())
-        throw std::runtime_error(RED_BOLD "Destination vertex `" + destination + "` does not exist in the graph.\n" DEFAULT_COLOR);
-    auto& neighbors = itSource->second;
-    if (neighbors.find(destination) != neighbors.end())
-        throw std::runtime_error(RED_BOLD "An edge already exists from vertex `" + source + "` to vertex `" + destination + "`.\n" DEFAULT_COLOR);
-    if (source == destination)
-        throw std::runtime_error(RED_BOLD "Self loops are not allowed.\n" DEFAULT_COLOR);
-    neighbors[destination] = weight;
+    if (this->maintainsTopologicalOrder)
+        this->reorderForEdge(source, destination);
 }
 
-void GraphWD::removeEdge(const Vertex_t& source, const Vertex_t& destination)
+void GraphWD::onEdgeInserted(const VertexId_t source, const VertexId_t destination, const size_t weight)
 {
-    auto itSource = this->adjacencyList.find(source);
-    if (itSource == this->adjacencyList.end())
-        throw std::runtime_error(RED_BOLD "Source vertex `" + source + "` does not exist in the graph.\n" DEFAULT_COLOR);
-    if (this->adjacencyList.find(destination) == this->adjacencyList.end())
-        throw std::runtime_error(RED_BOLD "Destination vertex `" + destination + "` does not exist in the graph.\n" DEFAULT_COLOR);
-    auto& neighbors = itSource->second;
-    auto itDestination = neighbors.find(destination);
-    if (itDestination == neighbors.end())
-        throw std::runtime_error(RED_BOLD "No edge exists from `" + source + "` to `" + destination + "`.\n" DEFAULT_COLOR);
-    neighbors.erase(itDestination);
-}
\ No newline at end of file
+    ++this->version;
+    if (this->shortestPathCache.cache != nullptr)
+        this->shortestPathCache.cache->onEdgeInserted(source, destination, weight, this->version);
+}
+
+void GraphWD::onEdgeRemoved(const VertexId_t source, const VertexId_t destination)
+{
+    ++this->version;
+    if (this->shortestPathCache.cache != nullptr)
+        this->shortestPathCache.cache->onEdgeRemoved(source, destination, this->version);
+}
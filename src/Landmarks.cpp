@@ -0,0 +1,66 @@
+/*
+    @file           Landmarks.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the methods managing the landmarks of A* searches, defined in the class `GraphWD`.
+*/
+
+#include "GraphWD.hpp"
+#include "LandmarkIndex.hpp"
+
+void GraphWD::buildLandmarks(const size_t count)
+{
+    this->setLandmarks(LandmarkIndex::selectFarthestLandmarks(*this, count));
+}
+
+void GraphWD::setLandmarks(const std::vector<Vertex_t>& landmarks)
+{
+    std::vector<VertexId_t> landmarkIds;
+    landmarkIds.reserve(landmarks.size());
+    for (const Vertex_t& landmark : landmarks)
+        landmarkIds.push_back(this->getExistingId(landmark, "Landmark vertex"));
+    this->setLandmarks(landmarkIds);
+}
+
+void GraphWD::setLandmarks(const std::vector<VertexId_t>& landmarks)
+{
+    for (const VertexId_t landmark : landmarks)
+        this->validateId(landmark, "Landmark vertex");
+    if (landmarks.empty())
+    {
+        this->landmarkIndex.reset();
+        return;
+    }
+    auto index = std::make_shared<LandmarkIndex>();
+    index->build(*this, landmarks);
+    this->landmarkIndex = std::move(index);
+    this->landmarkVersion = this->version;
+}
+
+void GraphWD::rebuildLandmarks(void)
+{
+    if (!this->landmarkIndex)
+        return;
+    std::vector<VertexId_t> landmarks;
+    for (const VertexId_t landmark : this->landmarkIndex->getLandmarks())
+        if (this->containsVertex(landmark))
+            landmarks.push_back(landmark);
+    this->setLandmarks(landmarks);
+}
+
+std::vector<Vertex_t> GraphWD::getLandmarks(void) const
+{
+    std::vector<Vertex_t> landmarks;
+    if (!this->landmarkIndex)
+        return landmarks;
+    for (const VertexId_t landmark : this->landmarkIndex->getLandmarks())
+        if (this->containsVertex(landmark))
+            landmarks.push_back(this->vertexNames[landmark]);
+    return landmarks;
+}
+
+bool GraphWD::areLandmarksUpToDate(void) const noexcept
+{
+    return this->landmarkIndex && this->landmarkVersion == this->version;
+}
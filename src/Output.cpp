@@ -12,11 +12,15 @@
 
 void GraphWD::printAdjacencyList(void) const noexcept
 {
-    for (const auto& [vertex, neighbors] : this->adjacencyList)
+    for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
     {
-        std::cout << YELLOW << '[' << BLUE_BOLD << vertex << YELLOW << ']' << MAGENTA_BOLD << "\t-->\t" << DEFAULT_COLOR;
-        for (const auto& [neighbor, weight] : neighbors)
-            std::cout << YELLOW << '(' << CYAN_BOLD << neighbor << YELLOW << ", " << MAGENTA_BOLD << weight << YELLOW << "), " << DEFAULT_COLOR;
+        if (!this->containsVertex(vertex))
+            continue;
+        std::cout << YELLOW << '[' << BLUE_BOLD << this->vertexNames[vertex] << YELLOW << ']' << MAGENTA_BOLD << "\t-->\t" << DEFAULT_COLOR;
+        this->forEachNeighbor(vertex, [this](const VertexId_t neighbor, const size_t weight)
+            {
+                std::cout << YELLOW << '(' << CYAN_BOLD << this->vertexNames[neighbor] << YELLOW << ", " << MAGENTA_BOLD << weight << YELLOW << "), " << DEFAULT_COLOR;
+            });
         std::cout << YELLOW << "\b\b." DEFAULT_COLOR << std::endl;
     }
 }
\ No newline at end of file
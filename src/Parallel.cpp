@@ -0,0 +1,113 @@
+/*
+    @file           Parallel.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the parallel shortest paths methods defined in the class `GraphWD`.
+    @details        Every task runs one single-source search with the Dijkstra engine of its worker thread, so that workers never share
+    @details        mutable state: the graph is only read, and every task writes its own slot of the results.
+    @details        A delta-stepping search instead shares its distances between workers, and relaxes them atomically.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+#include "GraphWD.hpp"
+#include "ThreadPool.hpp"
+#include "DijkstraEngine.hpp"
+#include "DeltaSteppingEngine.hpp"
+#include "TextColors.hpp"
+
+namespace
+{
+    /*
+        @brief      Calls a given function on every index of a range, on a pool of at most a given number of threads.
+        @param      count The number of indices, from zero.
+        @param      threads The number of worker threads, or zero for the number of hardware threads.
+        @param      function The callable invoked as `function(index)`.
+    */
+    template <typename Function>
+    void runParallel(const size_t count, const unsigned threads, Function&& function)
+    {
+        ThreadPool* const pool = ThreadPool::getShared(threads, count);
+        if (pool != nullptr)
+            pool->parallelFor(0, count, 1, function);
+        else
+            for (size_t index = 0; index < count; ++index)
+                function(index);
+    }
+}
+
+std::vector<std::map<Vertex_t, size_t>> GraphWD::getShortestPathsBatch(const std::vector<Vertex_t>& sources, const unsigned threads) const
+{
+    std::vector<VertexId_t> sourceIds;
+    sourceIds.reserve(sources.size());
+    for (const Vertex_t& source : sources)
+        sourceIds.push_back(this->getExistingId(source, "Starting vertex"));
+    std::vector<std::map<Vertex_t, size_t>> reachables(sources.size());
+    runParallel(sourceIds.size(), threads, [&](const size_t index)
+        {
+            auto& engine = getThreadLocalDijkstraEngine();
+            engine.run(*this, sourceIds[index]);
+            for (const VertexId_t vertex : engine.getSettled())
+                reachables[index].emplace(this->vertexNames[vertex], engine.getDistance(vertex));
+        });
+    return reachables;
+}
+
+std::vector<std::vector<size_t>> GraphWD::getShortestPathsBatch(const std::vector<VertexId_t>& sources, const unsigned threads) const
+{
+    for (const VertexId_t source : sources)
+        this->validateId(source, "Starting vertex");
+    std::vector<std::vector<size_t>> minDistances(sources.size());
+    runParallel(sources.size(), threads, [&](const size_t index)
+        {
+            auto& engine = getThreadLocalDijkstraEngine();
+            engine.run(*this, sources[index]);
+            minDistances[index].assign(this->getIdBound(), SIZE_MAX);
+            for (const VertexId_t vertex : engine.getSettled())
+                minDistances[index][vertex] = engine.getDistance(vertex);
+        });
+    return minDistances;
+}
+
+std::vector<size_t> GraphWD::getAllPairsShortestPaths(const unsigned threads) const
+{
+    const size_t idBound = this->getIdBound();
+    std::vector<size_t> matrix;
+    if (idBound != 0 && idBound > matrix.max_size() / idBound)
+        throw std::runtime_error(RED_BOLD "The distance matrix of " + std::to_string(idBound) + " vertices does not fit in memory.\n" DEFAULT_COLOR);
+    matrix.assign(idBound * idBound, SIZE_MAX);
+    runParallel(idBound, threads, [&](const size_t index)
+        {
+            const VertexId_t source = static_cast<VertexId_t>(index);
+            if (!this->containsVertex(source))
+                return;
+            auto& engine = getThreadLocalDijkstraEngine();
+            engine.run(*this, source);
+            size_t* const row = matrix.data() + index * idBound;
+            for (const VertexId_t vertex : engine.getSettled())
+                row[vertex] = engine.getDistance(vertex);
+        });
+    return matrix;
+}
+
+std::map<Vertex_t, size_t> GraphWD::getDeltaSteppingShortestPaths(const Vertex_t& source, const size_t delta, const unsigned threads) const
+{
+    const std::vector<size_t> minDistances = this->getDeltaSteppingShortestPaths(this->getExistingId(source, "Starting vertex"), delta, threads);
+    std::map<Vertex_t, size_t> reachable;
+    for (VertexId_t vertex = 0; vertex < minDistances.size(); ++vertex)
+        if (minDistances[vertex] != SIZE_MAX)
+            reachable.emplace(this->vertexNames[vertex], minDistances[vertex]);
+    return reachable;
+}
+
+std::vector<size_t> GraphWD::getDeltaSteppingShortestPaths(const VertexId_t source, const size_t delta, const unsigned threads) const
+{
+    this->validateId(source, "Starting vertex");
+    auto& engine = getThreadLocalDeltaSteppingEngine();
+    engine.run(*this, source, delta, ThreadPool::getShared(threads));
+    std::vector<size_t> minDistances(this->getIdBound());
+    for (VertexId_t vertex = 0; vertex < minDistances.size(); ++vertex)
+        minDistances[vertex] = engine.getDistance(vertex);
+    return minDistances;
+}
@@ -0,0 +1,393 @@
+/*
+    @file           Persistence.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the binary file format of `GraphWD`, written by `GraphWD::save` and mapped by `GraphWD::openMapped`.
+    @details        A file is a 64-byte header followed by six sections, each padded to a multiple of 8 bytes:
+    @details        `nameOffsets` and `offsets` (`idBound + 1` 64-bit integers each), `weights` (`size` 64-bit integers),
+    @details        `sortedIds` (`order` vertex ids), `targets` (`size` vertex ids) and `nameChars` (`nameBytes` characters).
+    @details        The checksum covers every byte after the header, read as 64-bit words.
+    @details        A file is written next to its destination under a temporary name, synchronized, then renamed over the destination,
+    @details        so that views mapping the previous file keep reading it unchanged, and a crash never leaves a partial file behind.
+    @details        The directory is synchronized after the rename, so that the new file survives a crash once `save` returns.
+*/
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+#include <filesystem>
+#include <system_error>
+#include "GraphWD.hpp"
+#include "GraphWDView.hpp"
+#include "TextColors.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define GRAPH_WD_HAS_MMAP
+#endif
+
+namespace
+{
+    constexpr char MAGIC[8] = { 'G', 'R', 'A', 'P', 'H', 'W', 'D', '\0' };
+    constexpr std::uint32_t FORMAT_VERSION = 1;
+    constexpr std::uint64_t BYTE_ORDER_MARK = 0x0102030405060708;
+
+    //  @struct     Header
+    //  @brief      The header at the beginning of a graph file.
+    struct Header
+    {
+        char magic[8];
+        std::uint32_t formatVersion;
+        std::uint32_t idBytes;
+        std::uint64_t byteOrder;
+        std::uint64_t idBound;
+        std::uint64_t order;
+        std::uint64_t size;
+        std::uint64_t nameBytes;
+        std::uint64_t checksum;
+    };
+
+    static_assert(sizeof(Header) == 64, "The header must keep the sections 8-byte aligned.");
+
+    //  @brief      Rounds a given number of bytes up to a multiple of 8.
+    constexpr std::uint64_t padded(const std::uint64_t bytes) noexcept
+    {
+        return (bytes + 7) / 8 * 8;
+    }
+
+    //  @brief      Mixes a given 64-bit word into a given checksum (FNV-1a over words).
+    constexpr std::uint64_t mix(const std::uint64_t checksum, const std::uint64_t word) noexcept
+    {
+        return (checksum ^ word) * 0x100000001B3;
+    }
+
+    constexpr std::uint64_t CHECKSUM_SEED = 0xCBF29CE484222325;
+
+    /*
+        @class      Writer
+        @brief      Writes the sections of a graph file through a buffer, and computes their checksum on the way.
+    */
+    class Writer final
+    {
+    private:
+        std::ofstream& file;
+        std::vector<char> buffer;
+        std::uint64_t checksum = CHECKSUM_SEED;
+
+        //  @brief      Mixes the buffered whole words into the checksum, writes them, and keeps the remaining bytes buffered.
+        void flush(void)
+        {
+            const size_t length = this->buffer.size() / 8 * 8;
+            for (size_t index = 0; index < length; index += 8)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, this->buffer.data() + index, 8);
+                this->checksum = mix(this->checksum, word);
+            }
+            this->file.write(this->buffer.data(), static_cast<std::streamsize>(length));
+            this->buffer.erase(this->buffer.begin(), this->buffer.begin() + static_cast<std::ptrdiff_t>(length));
+        }
+
+    public:
+        explicit Writer(std::ofstream& file) : file(file)
+        {
+            this->buffer.reserve(1 << 16);
+        }
+
+        //  @brief      Appends a given value to the current section.
+        template <typename Value>
+        void write(const Value& value)
+        {
+            const char* const bytes = reinterpret_cast<const char*>(&value);
+            this->buffer.insert(this->buffer.end(), bytes, bytes + sizeof(Value));
+            if (this->buffer.size() >= (1 << 16))
+                this->flush();
+        }
+
+        //  @brief      Appends given characters to the current section.
+        void write(const std::string& characters)
+        {
+            for (const char character : characters)
+                this->write(character);
+        }
+
+        //  @brief      Pads the current section to a multiple of 8 bytes, so that the next one is aligned.
+        void endSection(void)
+        {
+            this->buffer.resize(padded(this->buffer.size()), '\0');
+            if (this->buffer.size() >= (1 << 16))
+                this->flush();
+        }
+
+        //  @brief      Writes the remaining buffered bytes, and gets the checksum of everything written.
+        std::uint64_t finish(void)
+        {
+            this->endSection();
+            this->flush();
+            return this->checksum;
+        }
+    };
+
+    //  @struct     Mapping
+    //  @brief      The bytes of an opened graph file, unmapped or freed when the last view using them is destroyed.
+    struct Mapping
+    {
+        const char* data = nullptr;
+        size_t length = 0;
+        std::vector<std::uint64_t> fallback;
+
+        Mapping(void) = default;
+        Mapping(const Mapping&) = delete;
+        Mapping& operator=(const Mapping&) = delete;
+
+        ~Mapping(void)
+        {
+#ifdef GRAPH_WD_HAS_MMAP
+            if (this->data != nullptr && this->fallback.empty())
+                munmap(const_cast<char*>(this->data), this->length);
+#endif
+        }
+    };
+
+    /*
+        @brief      Maps a given file into memory, or reads it into a buffer on platforms without `mmap`.
+        @param      path The path of the file.
+        @returns    `std::shared_ptr<Mapping>` The bytes of the file, 8-byte aligned.
+        @throws     `std::runtime_error` If the file cannot be opened or mapped.
+    */
+    std::shared_ptr<Mapping> mapFile(const std::string& path)
+    {
+        auto mapping = std::make_shared<Mapping>();
+#ifdef GRAPH_WD_HAS_MMAP
+        const int descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+            throw std::runtime_error(RED_BOLD "File `" + path + "` cannot be opened.\n" DEFAULT_COLOR);
+        struct stat status;
+        if (fstat(descriptor, &status) != 0 || status.st_size < static_cast<off_t>(sizeof(Header)))
+        {
+            close(descriptor);
+            throw std::runtime_error(RED_BOLD "File `" + path + "` is not a graph file.\n" DEFAULT_COLOR);
+        }
+        void* const data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_SHARED, descriptor, 0);
+        close(descriptor);
+        if (data == MAP_FAILED)
+            throw std::runtime_error(RED_BOLD "File `" + path + "` cannot be mapped into memory.\n" DEFAULT_COLOR);
+        mapping->data = static_cast<const char*>(data);
+        mapping->length = static_cast<size_t>(status.st_size);
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+            throw std::runtime_error(RED_BOLD "File `" + path + "` cannot be opened.\n" DEFAULT_COLOR);
+        const size_t length = static_cast<size_t>(file.tellg());
+        if (length < sizeof(Header))
+            throw std::runtime_error(RED_BOLD "File `" + path + "` is not a graph file.\n" DEFAULT_COLOR);
+        mapping->fallback.resize((length + 7) / 8);
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(mapping->fallback.data()), static_cast<std::streamsize>(length)))
+            throw std::runtime_error(RED_BOLD "File `" + path + "` cannot be read.\n" DEFAULT_COLOR);
+        mapping->data = reinterpret_cast<const char*>(mapping->fallback.data());
+        mapping->length = length;
+#endif
+        return mapping;
+    }
+
+    //  @brief      Gets a unique temporary path in the directory of a given path, so that renaming it over the given path is atomic.
+    std::string getTemporaryPath(const std::string& path)
+    {
+        static std::atomic<std::uint64_t> counter{ 0 };
+#ifdef GRAPH_WD_HAS_MMAP
+        const std::string process = std::to_string(getpid());
+#else
+        const std::string process = "0";
+#endif
+        return path + ".tmp." + process + "." + std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+    }
+
+    //  @brief      Flushes the written bytes of a given file to its storage device, where the platform allows it.
+    void synchronizeFile(const std::string& path)
+    {
+#ifdef GRAPH_WD_HAS_MMAP
+        const int descriptor = open(path.c_str(), O_RDONLY);
+        const bool isSynchronized = descriptor >= 0 && fsync(descriptor) == 0;
+        if (descriptor >= 0)
+            close(descriptor);
+        if (!isSynchronized)
+            throw std::runtime_error(RED_BOLD "File `" + path + "` cannot be synchronized.\n" DEFAULT_COLOR);
+#else
+        (void)path;
+#endif
+    }
+
+    //  @brief      Flushes the directory entries of the directory of a given path to its storage device, so that a rename into it is durable.
+    //  @note       File systems which cannot synchronize directories, reporting `EINVAL`, are trusted to order the rename after the file data.
+    void synchronizeDirectory(const std::string& path)
+    {
+#ifdef GRAPH_WD_HAS_MMAP
+        std::string directory = std::filesystem::path(path).parent_path().string();
+        if (directory.empty())
+            directory = ".";
+        const int descriptor = open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+        const bool isSynchronized = descriptor >= 0 && (fsync(descriptor) == 0 || errno == EINVAL);
+        if (descriptor >= 0)
+            close(descriptor);
+        if (!isSynchronized)
+            throw std::runtime_error(RED_BOLD "Directory `" + directory + "` cannot be synchronized.\n" DEFAULT_COLOR);
+#else
+        (void)path;
+#endif
+    }
+
+    //  @brief      Checks whether given offsets start at zero, never decrease, and end at a given total.
+    bool areOffsetsValid(const std::span<const std::uint64_t> offsets, const std::uint64_t total) noexcept
+    {
+        return offsets.front() == 0 && offsets.back() == total && std::is_sorted(offsets.begin(), offsets.end());
+    }
+
+    //  @brief      Gets a span of `count` values of a given type at a given byte position of a mapping, and moves the position past its section.
+    template <typename Value>
+    std::span<const Value> takeSection(const Mapping& mapping, size_t& position, const std::uint64_t count)
+    {
+        const std::span<const Value> section(reinterpret_cast<const Value*>(mapping.data + position), count);
+        position += padded(count * sizeof(Value));
+        return section;
+    }
+}
+
+void GraphWD::save(const std::string& path) const
+{
+    const std::string temporaryPath = getTemporaryPath(path);
+    try
+    {
+        this->writeFile(temporaryPath);
+        synchronizeFile(temporaryPath);
+        std::error_code error;
+        std::filesystem::rename(temporaryPath, path, error);
+        if (error)
+            throw std::runtime_error(RED_BOLD "File `" + path + "` cannot be written: " + error.message() + ".\n" DEFAULT_COLOR);
+    }
+    catch (...)
+    {
+        std::error_code ignored;
+        std::filesystem::remove(temporaryPath, ignored);
+        throw;
+    }
+    synchronizeDirectory(path);
+}
+
+void GraphWD::writeFile(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        throw std::runtime_error(RED_BOLD "File `" + path + "` cannot be written.\n" DEFAULT_COLOR);
+    std::vector<VertexId_t> sortedIds;
+    sortedIds.reserve(this->getOrder());
+    std::uint64_t nameBytes = 0;
+    for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
+        if (this->containsVertex(vertex))
+        {
+            sortedIds.push_back(vertex);
+            nameBytes += this->vertexNames[vertex].size();
+        }
+    std::sort(sortedIds.begin(), sortedIds.end(), [this](const VertexId_t a, const VertexId_t b) -> bool
+        {
+            return this->vertexNames[a] < this->vertexNames[b];
+        });
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.formatVersion = FORMAT_VERSION;
+    header.idBytes = sizeof(VertexId_t);
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.idBound = this->getIdBound();
+    header.order = this->getOrder();
+    header.size = this->getSize();
+    header.nameBytes = nameBytes;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+
+    Writer writer(file);
+    std::uint64_t offset = 0;
+    writer.write(offset);
+    for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
+        writer.write(offset += this->vertexNames[vertex].size());
+    writer.endSection();
+    offset = 0;
+    writer.write(offset);
+    for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
+        writer.write(offset += this->outgoing.getDegree(vertex));
+    writer.endSection();
+    for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
+        this->forEachNeighbor(vertex, [&](const VertexId_t, const size_t weight)
+            {
+                writer.write(static_cast<std::uint64_t>(weight));
+            });
+    writer.endSection();
+    for (const VertexId_t vertex : sortedIds)
+        writer.write(vertex);
+    writer.endSection();
+    for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
+        this->forEachNeighbor(vertex, [&](const VertexId_t neighbor, const size_t)
+            {
+                writer.write(neighbor);
+            });
+    writer.endSection();
+    for (VertexId_t vertex = 0; vertex < this->getIdBound(); ++vertex)
+        writer.write(this->vertexNames[vertex]);
+    header.checksum = writer.finish();
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.close();
+    if (!file)
+        throw std::runtime_error(RED_BOLD "File `" + path + "` cannot be written.\n" DEFAULT_COLOR);
+}
+
+GraphWDView GraphWD::openMapped(const std::string& path, const bool verifyChecksum)
+{
+    const std::shared_ptr<Mapping> mapping = mapFile(path);
+    Header header;
+    std::memcpy(&header, mapping->data, sizeof(Header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+        throw std::runtime_error(RED_BOLD "File `" + path + "` is not a graph file.\n" DEFAULT_COLOR);
+    if (header.formatVersion != FORMAT_VERSION || header.idBytes != sizeof(VertexId_t))
+        throw std::runtime_error(RED_BOLD "File `" + path + "` was written in format version " + std::to_string(header.formatVersion)
+            + ", but only version " + std::to_string(FORMAT_VERSION) + " is supported.\n" DEFAULT_COLOR);
+    if (header.byteOrder != BYTE_ORDER_MARK)
+        throw std::runtime_error(RED_BOLD "File `" + path + "` was written on a machine of another byte order.\n" DEFAULT_COLOR);
+    const std::uint64_t limit = mapping->length / 8;
+    if (header.idBound >= limit || header.size >= limit || header.order > header.idBound || header.nameBytes >= mapping->length
+        || sizeof(Header) + 16 * (header.idBound + 1) + padded(8 * header.size) + padded(sizeof(VertexId_t) * header.order)
+            + padded(sizeof(VertexId_t) * header.size) + padded(header.nameBytes) != mapping->length)
+        throw std::runtime_error(RED_BOLD "File `" + path + "` is truncated or corrupted.\n" DEFAULT_COLOR);
+    if (verifyChecksum)
+    {
+        std::uint64_t checksum = CHECKSUM_SEED;
+        const std::uint64_t* const words = reinterpret_cast<const std::uint64_t*>(mapping->data + sizeof(Header));
+        for (size_t index = 0; index < (mapping->length - sizeof(Header)) / 8; ++index)
+            checksum = mix(checksum, words[index]);
+        if (checksum != header.checksum)
+            throw std::runtime_error(RED_BOLD "File `" + path + "` is corrupted: its checksum does not match.\n" DEFAULT_COLOR);
+    }
+    GraphWDView view;
+    size_t position = sizeof(Header);
+    view.nameOffsets = takeSection<std::uint64_t>(*mapping, position, header.idBound + 1);
+    view.offsets = takeSection<std::uint64_t>(*mapping, position, header.idBound + 1);
+    view.weights = takeSection<std::uint64_t>(*mapping, position, header.size);
+    view.sortedIds = takeSection<VertexId_t>(*mapping, position, header.order);
+    view.targets = takeSection<VertexId_t>(*mapping, position, header.size);
+    view.nameChars = takeSection<char>(*mapping, position, header.nameBytes);
+    bool isValid = view.nameOffsets.front() == 0 && view.nameOffsets.back() == header.nameBytes
+        && view.offsets.front() == 0 && view.offsets.back() == header.size;
+    if (isValid && verifyChecksum)
+        isValid = areOffsetsValid(view.nameOffsets, header.nameBytes) && areOffsetsValid(view.offsets, header.size)
+            && std::all_of(view.targets.begin(), view.targets.end(), [&header](const VertexId_t id) { return id < header.idBound; })
+            && std::all_of(view.sortedIds.begin(), view.sortedIds.end(), [&header](const VertexId_t id) { return id < header.idBound; });
+    if (!isValid)
+        throw std::runtime_error(RED_BOLD "File `" + path + "` is truncated or corrupted.\n" DEFAULT_COLOR);
+    view.storage = mapping;
+    return view;
+}
@@ -0,0 +1,183 @@
+/*
+    @file           ShortestPathCache.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the methods of the class `ShortestPathCache`, and the shortest path cache methods defined in the class `GraphWD`.
+*/
+
+#include "ShortestPathCache.hpp"
+
+GraphWD::ShortestPathCacheHandle::ShortestPathCacheHandle(void) noexcept = default;
+
+GraphWD::ShortestPathCacheHandle::ShortestPathCacheHandle(const ShortestPathCacheHandle& other)
+{
+    // An empty cache follows whichever version it first sees, so the copy needs no version.
+    if (other.cache != nullptr)
+        this->cache = std::make_unique<ShortestPathCache>(other.cache->getMaxEntries(), other.cache->getMaxBytes(), 0);
+}
+
+GraphWD::ShortestPathCacheHandle::ShortestPathCacheHandle(ShortestPathCacheHandle&& other) noexcept = default;
+
+GraphWD::ShortestPathCacheHandle& GraphWD::ShortestPathCacheHandle::operator=(const ShortestPathCacheHandle& other)
+{
+    if (this != &other)
+        this->cache = ShortestPathCacheHandle(other).cache;
+    return *this;
+}
+
+GraphWD::ShortestPathCacheHandle& GraphWD::ShortestPathCacheHandle::operator=(ShortestPathCacheHandle&& other) noexcept = default;
+
+GraphWD::ShortestPathCacheHandle::~ShortestPathCacheHandle() = default;
+
+void GraphWD::setShortestPathCache(const size_t maxEntries, const size_t maxBytes)
+{
+    if (maxEntries == 0)
+        this->shortestPathCache.cache.reset();
+    else
+        this->shortestPathCache.cache = std::make_unique<ShortestPathCache>(maxEntries, maxBytes, this->version);
+}
+
+void GraphWD::clearShortestPathCache(void)
+{
+    if (this->shortestPathCache.cache != nullptr)
+        this->shortestPathCache.cache->clear();
+}
+
+GraphWD::CacheCounters GraphWD::getShortestPathCacheCounters(void) const
+{
+    return this->shortestPathCache.cache != nullptr ? this->shortestPathCache.cache->getCounters() : CacheCounters();
+}
+
+ShortestPathCache::ShortestPathCache(const size_t maxEntries, const size_t maxBytes, const size_t version) noexcept
+    : maxEntries(maxEntries), maxBytes(maxBytes), version(version)
+{
+}
+
+size_t ShortestPathCache::getMaxEntries(void) const noexcept
+{
+    return this->maxEntries;
+}
+
+size_t ShortestPathCache::getMaxBytes(void) const noexcept
+{
+    return this->maxBytes;
+}
+
+void ShortestPathCache::erase(const std::list<Entry>::iterator itEntry)
+{
+    this->bytes -= itEntry->bytes;
+    this->index.erase(itEntry->source);
+    this->entries.erase(itEntry);
+}
+
+void ShortestPathCache::synchronize(const size_t graphVersion)
+{
+    if (this->version == graphVersion)
+        return;
+    this->counters.invalidations += this->entries.size();
+    this->entries.clear();
+    this->index.clear();
+    this->bytes = 0;
+    this->version = graphVersion;
+}
+
+template <typename Predicate>
+void ShortestPathCache::invalidateIf(const size_t newVersion, Predicate&& predicate)
+{
+    const std::lock_guard<std::mutex> lock(this->mutex);
+    this->synchronize(newVersion - 1);
+    for (auto itEntry = this->entries.begin(); itEntry != this->entries.end();)
+        if (predicate(*itEntry->tree, itEntry->source))
+        {
+            ++this->counters.invalidations;
+            this->erase(itEntry++);
+        }
+        else
+            ++itEntry;
+    this->version = newVersion;
+}
+
+std::shared_ptr<const ShortestPathCache::Tree> ShortestPathCache::find(const VertexId_t source, const size_t graphVersion)
+{
+    const std::lock_guard<std::mutex> lock(this->mutex);
+    this->synchronize(graphVersion);
+    const auto itIndex = this->index.find(source);
+    if (itIndex == this->index.end())
+    {
+        ++this->counters.misses;
+        return nullptr;
+    }
+    ++this->counters.hits;
+    this->entries.splice(this->entries.begin(), this->entries, itIndex->second);
+    return itIndex->second->tree;
+}
+
+void ShortestPathCache::insert(const VertexId_t source, const size_t graphVersion, std::shared_ptr<const Tree> tree)
+{
+    const size_t treeBytes = sizeof(Entry) + sizeof(Tree) + tree->distances.capacity() * sizeof(size_t)
+        + tree->predecessors.capacity() * sizeof(VertexId_t);
+    const std::lock_guard<std::mutex> lock(this->mutex);
+    this->synchronize(graphVersion);
+    if (const auto itIndex = this->index.find(source); itIndex != this->index.end())
+        this->erase(itIndex->second);
+    if (treeBytes > this->maxBytes)
+        return;
+    while (this->entries.size() >= this->maxEntries || this->bytes + treeBytes > this->maxBytes)
+    {
+        ++this->counters.evictions;
+        this->erase(std::prev(this->entries.end()));
+    }
+    this->entries.push_front({ source, std::move(tree), treeBytes });
+    this->index.emplace(source, this->entries.begin());
+    this->bytes += treeBytes;
+}
+
+void ShortestPathCache::onEdgeInserted(const VertexId_t source, const VertexId_t destination, const size_t weight, const size_t newVersion)
+{
+    this->invalidateIf(newVersion, [=](const Tree& tree, const VertexId_t)
+        {
+            const size_t sourceDistance = tree.getDistance(source);
+            return sourceDistance != SIZE_MAX && sourceDistance + weight < tree.getDistance(destination);
+        });
+}
+
+void ShortestPathCache::onEdgeRemoved(const VertexId_t source, const VertexId_t destination, const size_t newVersion)
+{
+    this->invalidateIf(newVersion, [=](const Tree& tree, const VertexId_t treeSource)
+        {
+            return destination != treeSource && tree.getDistance(destination) != SIZE_MAX && tree.predecessors[destination] == source;
+        });
+}
+
+void ShortestPathCache::onVertexRemoved(const VertexId_t id, const size_t newVersion)
+{
+    this->invalidateIf(newVersion, [=](const Tree& tree, const VertexId_t)
+        {
+            return tree.getDistance(id) != SIZE_MAX;
+        });
+}
+
+void ShortestPathCache::onVertexInserted(const size_t newVersion)
+{
+    const std::lock_guard<std::mutex> lock(this->mutex);
+    this->synchronize(newVersion - 1);
+    this->version = newVersion;
+}
+
+void ShortestPathCache::clear(void)
+{
+    const std::lock_guard<std::mutex> lock(this->mutex);
+    this->entries.clear();
+    this->index.clear();
+    this->bytes = 0;
+}
+
+GraphWD::CacheCounters ShortestPathCache::getCounters(void) const
+{
+    const std::lock_guard<std::mutex> lock(this->mutex);
+    GraphWD::CacheCounters current = this->counters;
+    current.entries = this->entries.size();
+    current.bytes = this->bytes;
+    return current;
+}
@@ -0,0 +1,168 @@
+/*
+    @file           ThreadPool.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the thread pool `ThreadPool`, and the registry of its shared instances.
+*/
+
+#include <map>
+#include <algorithm>
+#include "ThreadPool.hpp"
+
+namespace
+{
+    thread_local const ThreadPool* currentPool = nullptr;
+    thread_local size_t currentWorker = 0;
+}
+
+void ThreadPool::TaskGroup::finish(std::exception_ptr exception, const size_t count) noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (exception && !this->firstException)
+        this->firstException = exception;
+    this->pendingTasks -= count;
+    if (this->pendingTasks == 0)
+        this->tasksFinished.notify_all();
+}
+
+bool ThreadPool::TaskGroup::isFinished(void) noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->pendingTasks == 0;
+}
+
+void ThreadPool::TaskGroup::wait(void)
+{
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->tasksFinished.wait(lock, [this] { return this->pendingTasks == 0; });
+    if (this->firstException)
+        std::rethrow_exception(this->firstException);
+}
+
+ThreadPool::ThreadPool(const unsigned threadCount)
+{
+    const unsigned count = threadCount != 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned index = 0; index < count; ++index)
+        this->workers.push_back(std::make_unique<Worker>());
+    try
+    {
+        for (unsigned index = 0; index < count; ++index)
+            this->threads.emplace_back(&ThreadPool::runWorker, this, index);
+    }
+    catch (...)
+    {
+        this->stop();
+        throw;
+    }
+}
+
+ThreadPool::~ThreadPool(void)
+{
+    this->stop();
+}
+
+void ThreadPool::stop(void) noexcept
+{
+    this->stopping.store(true, std::memory_order_release);
+    this->queuedTasks.release(static_cast<std::ptrdiff_t>(this->threads.size()));
+    for (std::thread& thread : this->threads)
+        thread.join();
+    this->threads.clear();
+}
+
+ThreadPool* ThreadPool::getShared(const unsigned threadCount, const size_t taskCount)
+{
+    static std::mutex registryMutex;
+    static std::map<unsigned, std::unique_ptr<ThreadPool>> registry;
+    const unsigned count = threadCount != 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+    if (count <= 1 || taskCount <= 1)
+        return nullptr;
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::unique_ptr<ThreadPool>& pool = registry[count];
+    if (pool == nullptr)
+        pool = std::make_unique<ThreadPool>(count);
+    return pool.get();
+}
+
+size_t ThreadPool::getThreadCount(void) const noexcept
+{
+    return this->workers.size();
+}
+
+size_t ThreadPool::getCurrentWorker(void) const noexcept
+{
+    return currentPool == this ? currentWorker : this->workers.size();
+}
+
+void ThreadPool::submit(std::function<void(void)> task)
+{
+    size_t index = this->getCurrentWorker();
+    if (index == this->workers.size())
+        index = this->nextWorker.fetch_add(1, std::memory_order_relaxed) % this->workers.size();
+    {
+        std::lock_guard<std::mutex> lock(this->workers[index]->mutex);
+        this->workers[index]->tasks.push_back(std::move(task));
+    }
+    this->queuedTasks.release();
+}
+
+bool ThreadPool::findTask(const size_t index, std::function<void(void)>& task)
+{
+    {
+        Worker& own = *this->workers[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+    for (size_t offset = 1; offset < this->workers.size(); ++offset)
+    {
+        Worker& victim = *this->workers[(index + offset) % this->workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::runWorker(const size_t index)
+{
+    currentPool = this;
+    currentWorker = index;
+    std::function<void(void)> task;
+    while (true)
+    {
+        this->queuedTasks.acquire();
+        if (this->stopping.load(std::memory_order_acquire))
+            return;
+        while (!this->findTask(index, task))
+            std::this_thread::yield();
+        task();
+        task = nullptr;
+    }
+}
+
+void ThreadPool::wait(TaskGroup& group)
+{
+    const size_t index = this->getCurrentWorker();
+    if (index != this->workers.size())
+    {
+        std::function<void(void)> task;
+        while (!group.isFinished() && this->queuedTasks.try_acquire())
+        {
+            while (!this->findTask(index, task))
+                std::this_thread::yield();
+            task();
+            task = nullptr;
+        }
+    }
+    group.wait();
+}
@@ -0,0 +1,140 @@
+/*
+    @file           TopologicalOrder.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Implements the maintenance of a topological order of the graph under insertions and removals, defined in the class `GraphWD`.
+    @details        Edge insertions follow the dynamic topological sort of Pearce and Kelly: an edge `source -> destination` ordered backwards
+    @details        searches forwards from the destination and backwards from the source, within the range of positions between them, and
+    @details        reassigns the positions of the visited vertices so that the backward set precedes the forward set.
+    @details        Vertex removals leave tombstones, which Pearce-Kelly never moves since it only visits vertices, and which are
+    @details        compacted once they outnumber the vertices, so that a removal costs amortized constant time.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+#include "GraphWD.hpp"
+#include "GraphKernels.hpp"
+#include "TextColors.hpp"
+
+void GraphWD::reorderForEdge(const VertexId_t source, const VertexId_t destination)
+{
+    const size_t lowerBound = this->topologicalIndices[destination], upperBound = this->topologicalIndices[source];
+    if (upperBound < lowerBound)
+        return;
+    std::vector<VertexId_t> forward{ destination }, backward{ source };
+    this->topologicalMarks[destination] = true;
+    this->topologicalMarks[source] = true;
+    bool isCycle = false;
+    for (size_t index = 0; index < forward.size() && !isCycle; ++index)
+        this->forEachNeighbor(forward[index], [&](const VertexId_t neighbor, const size_t) -> bool
+            {
+                if (neighbor == source)
+                {
+                    isCycle = true;
+                    return false;
+                }
+                if (!this->topologicalMarks[neighbor] && this->topologicalIndices[neighbor] < upperBound)
+                {
+                    this->topologicalMarks[neighbor] = true;
+                    forward.push_back(neighbor);
+                }
+                return true;
+            });
+    if (!isCycle)
+        for (size_t index = 0; index < backward.size(); ++index)
+            this->forEachPredecessor(backward[index], [&](const VertexId_t predecessor, const size_t)
+                {
+                    if (!this->topologicalMarks[predecessor] && this->topologicalIndices[predecessor] > lowerBound)
+                    {
+                        this->topologicalMarks[predecessor] = true;
+                        backward.push_back(predecessor);
+                    }
+                });
+    for (const VertexId_t vertex : forward)
+        this->topologicalMarks[vertex] = false;
+    for (const VertexId_t vertex : backward)
+        this->topologicalMarks[vertex] = false;
+    if (isCycle)
+        throw std::runtime_error(RED_BOLD "An edge from vertex `" + this->vertexNames[source] + "` to vertex `" + this->vertexNames[destination] + "` would create a cycle.\n" DEFAULT_COLOR);
+
+    const auto isBefore = [this](const VertexId_t a, const VertexId_t b) { return this->topologicalIndices[a] < this->topologicalIndices[b]; };
+    std::sort(forward.begin(), forward.end(), isBefore);
+    std::sort(backward.begin(), backward.end(), isBefore);
+    std::vector<size_t> positions;
+    positions.reserve(forward.size() + backward.size());
+    for (const VertexId_t vertex : backward)
+        positions.push_back(this->topologicalIndices[vertex]);
+    for (const VertexId_t vertex : forward)
+        positions.push_back(this->topologicalIndices[vertex]);
+    std::inplace_merge(positions.begin(), positions.begin() + static_cast<std::ptrdiff_t>(backward.size()), positions.end());
+    size_t next = 0;
+    for (const std::vector<VertexId_t>* const vertices : { &backward, &forward })
+        for (const VertexId_t vertex : *vertices)
+        {
+            this->topologicalIndices[vertex] = positions[next];
+            this->topologicalOrder[positions[next++]] = vertex;
+        }
+}
+
+void GraphWD::compactTopologicalOrder(void) noexcept
+{
+    std::erase(this->topologicalOrder, TOPOLOGICAL_TOMBSTONE);
+    for (size_t index = 0; index < this->topologicalOrder.size(); ++index)
+        this->topologicalIndices[this->topologicalOrder[index]] = index;
+    this->topologicalTombstones = 0;
+}
+
+void GraphWD::setTopologicalOrderMaintenance(const bool isEnabled)
+{
+    if (!isEnabled)
+    {
+        this->maintainsTopologicalOrder = false;
+        this->topologicalOrder = std::vector<VertexId_t>();
+        this->topologicalIndices = std::vector<size_t>();
+        this->topologicalMarks = std::vector<bool>();
+        this->topologicalTombstones = 0;
+        return;
+    }
+    if (this->maintainsTopologicalOrder)
+        return;
+    auto [sortable, sortedIds] = GraphKernels::kahn(*this);
+    if (!sortable)
+        throw std::runtime_error(RED_BOLD "The graph contains a cycle, so it has no topological order.\n" DEFAULT_COLOR);
+    this->topologicalOrder = std::move(sortedIds);
+    this->topologicalIndices.assign(this->getIdBound(), 0);
+    for (size_t index = 0; index < this->topologicalOrder.size(); ++index)
+        this->topologicalIndices[this->topologicalOrder[index]] = index;
+    this->topologicalMarks.assign(this->getIdBound(), false);
+    this->maintainsTopologicalOrder = true;
+}
+
+bool GraphWD::isTopologicalOrderMaintained(void) const noexcept
+{
+    return this->maintainsTopologicalOrder;
+}
+
+std::vector<VertexId_t> GraphWD::getTopologicalOrder(void) const
+{
+    if (!this->maintainsTopologicalOrder)
+        throw std::runtime_error(RED_BOLD "No topological order is maintained.\n" DEFAULT_COLOR);
+    std::vector<VertexId_t> order;
+    order.reserve(this->topologicalOrder.size() - this->topologicalTombstones);
+    for (const VertexId_t vertex : this->topologicalOrder)
+        if (vertex != TOPOLOGICAL_TOMBSTONE)
+            order.push_back(vertex);
+    return order;
+}
+
+size_t GraphWD::getTopologicalIndex(const Vertex_t& vertex) const
+{
+    return this->getTopologicalIndex(this->getExistingId(vertex, "Vertex"));
+}
+
+size_t GraphWD::getTopologicalIndex(const VertexId_t id) const
+{
+    this->validateId(id, "Vertex");
+    if (!this->maintainsTopologicalOrder)
+        throw std::runtime_error(RED_BOLD "No topological order is maintained.\n" DEFAULT_COLOR);
+    return this->topologicalIndices[id];
+}
@@ -0,0 +1,178 @@
+/*
+    @file           BfsEngineTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that the direction-optimizing `BfsEngine` finds the same BFS tree depths with its bottom-up steps taken and disabled,
+    @brief          on the calling thread and on a thread pool, and that `GraphWD::getBFSTree` returns them.
+*/
+
+#include <map>
+#include <deque>
+#include <string>
+#include <vector>
+#include <utility>
+#include "GraphWD.hpp"
+#include "BfsEngine.hpp"
+#include "ThreadPool.hpp"
+#include "TestGraphs.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    /*
+        @class      TopDownGraph
+        @brief      Exposes a graph without its `forEachPredecessor`, so that `BfsEngine` never expands a level bottom-up.
+    */
+    class TopDownGraph final
+    {
+    private:
+        const GraphWD& graph;
+
+    public:
+        explicit TopDownGraph(const GraphWD& graph) : graph(graph)
+        {
+        }
+
+        size_t getOrder(void) const noexcept
+        {
+            return this->graph.getOrder();
+        }
+
+        size_t getSize(void) const noexcept
+        {
+            return this->graph.getSize();
+        }
+
+        VertexId_t getIdBound(void) const noexcept
+        {
+            return this->graph.getIdBound();
+        }
+
+        bool containsVertex(const VertexId_t id) const noexcept
+        {
+            return this->graph.containsVertex(id);
+        }
+
+        template <typename Visitor>
+        void forEachNeighbor(const VertexId_t id, Visitor&& visitor) const
+        {
+            this->graph.forEachNeighbor(id, visitor);
+        }
+    };
+
+    //  @brief      Computes the depths of the BFS tree of a given graph from a given start with a plain queue, `SIZE_MAX` for unreachable vertices.
+    std::vector<size_t> getReferenceDepths(const GraphWD& graph, const VertexId_t start)
+    {
+        std::vector<size_t> depths(graph.getIdBound(), SIZE_MAX);
+        std::deque<VertexId_t> queue{ start };
+        depths[start] = 0;
+        while (!queue.empty())
+        {
+            const VertexId_t current = queue.front();
+            queue.pop_front();
+            graph.forEachNeighbor(current, [&](const VertexId_t neighbor, const size_t)
+                {
+                    if (depths[neighbor] == SIZE_MAX)
+                    {
+                        depths[neighbor] = depths[current] + 1;
+                        queue.push_back(neighbor);
+                    }
+                });
+        }
+        return depths;
+    }
+
+    //  @brief      Checks whether the last search of a given engine found given depths, through an edge from a parent one level up.
+    bool isMatchingDepths(const BfsEngine& engine, const GraphWD& graph, const VertexId_t start, const std::vector<size_t>& depths)
+    {
+        bool isMatching = engine.getParent(start) == start;
+        size_t reachedCount = 0;
+        for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+        {
+            isMatching &= engine.getDepth(id) == depths[id] && engine.isReached(id) == (depths[id] != SIZE_MAX);
+            if (depths[id] == SIZE_MAX)
+                continue;
+            ++reachedCount;
+            if (id == start)
+                continue;
+            const VertexId_t parent = engine.getParent(id);
+            isMatching &= graph.containsVertex(parent) && depths[parent] + 1 == depths[id];
+            try
+            {
+                graph.getWeight(parent, id);
+            }
+            catch (const std::runtime_error&)
+            {
+                isMatching = false;
+            }
+        }
+        return isMatching && engine.getReachedCount() == reachedCount;
+    }
+}
+
+TEST_CASE(bfsEngineFindsTheSameDepthsBottomUpAndTopDown)
+{
+    ThreadPool pool(2);
+    BfsEngine engine;
+    for (const unsigned seed : { 43u, 47u })
+    {
+        // Dense graphs make the frontier outgrow the unexplored edges quickly, so that bottom-up steps are taken.
+        const GraphWD graph = TestGraphs::makeRandomGraph(seed == 43 ? 300 : 1200, seed == 43 ? 6000 : 9000, 5, seed);
+        const TopDownGraph topDown(graph);
+        for (VertexId_t start = 0; start < graph.getIdBound(); start += 97)
+        {
+            if (!graph.containsVertex(start))
+                continue;
+            const std::vector<size_t> expected = getReferenceDepths(graph, start);
+            for (ThreadPool* const threads : { static_cast<ThreadPool*>(nullptr), &pool })
+            {
+                engine.run(graph, start, threads);
+                CHECK(engine.getBottomUpStepCount() > 0);
+                CHECK(isMatchingDepths(engine, graph, start, expected));
+                engine.run(topDown, start, threads);
+                CHECK(engine.getBottomUpStepCount() == 0);
+                CHECK(isMatchingDepths(engine, graph, start, expected));
+            }
+        }
+    }
+}
+
+TEST_CASE(bfsEngineStopsAtUnreachableVertices)
+{
+    GraphWD graph;
+    for (const Vertex_t vertex : { "a", "b", "c", "d" })
+        graph.insertVertex(vertex);
+    graph.insertEdge("a", "b", 1);
+    graph.insertEdge("b", "c", 1);
+    graph.insertEdge("d", "a", 1);
+    BfsEngine engine;
+    engine.run(graph, 0);
+    CHECK(engine.getReachedCount() == 3);
+    CHECK(engine.getDepth(2) == 2 && engine.getParent(2) == 1);
+    CHECK(!engine.isReached(3) && engine.getDepth(3) == SIZE_MAX);
+    // A shorter graph afterwards must not see the visits of the previous search.
+    GraphWD single;
+    single.insertVertex("a");
+    engine.run(single, 0);
+    CHECK(engine.getReachedCount() == 1);
+    CHECK(!engine.isReached(1));
+}
+
+TEST_CASE(bfsTreeOfTheGraphMatchesTheEngine)
+{
+    const GraphWD graph = TestGraphs::makeRandomGraph(400, 5000, 5, 53);
+    for (const unsigned threads : { 1u, 2u })
+    {
+        const auto [depths, parents] = graph.getBFSTree(VertexId_t(0), threads);
+        CHECK(depths == getReferenceDepths(graph, 0));
+        CHECK(parents[0] == 0 && parents[5] == graph.getIdBound());
+        const std::map<Vertex_t, std::pair<size_t, Vertex_t>> tree = graph.getBFSTree("v0", threads);
+        bool isMatching = true;
+        for (const auto& [vertex, node] : tree)
+            isMatching &= depths[graph.getVertexId(vertex)] == node.first && graph.getVertexId(node.second) == parents[graph.getVertexId(vertex)];
+        CHECK(isMatching);
+    }
+    CHECK_THROWS(graph.getBFSTree(VertexId_t(5), 1));
+    CHECK_THROWS(graph.getBFSTree("missing", 1));
+}
@@ -0,0 +1,97 @@
+/*
+    @file           CompressedGraphWDTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that `GraphWD::compress` round-trips the neighbors and weights of the graph through the gap and varint encoding,
+    @brief          and that the algorithms of the snapshot match the ones of the graph.
+*/
+
+#include <string>
+#include <vector>
+#include <utility>
+#include "GraphWD.hpp"
+#include "CompressedGraphWD.hpp"
+#include "TestGraphs.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Checks whether a given snapshot has the vertex ids, names, degrees, neighbors and weights of a given graph.
+    bool isMatchingGraph(const CompressedGraphWD& compressed, const GraphWD& graph)
+    {
+        if (compressed.getOrder() != graph.getOrder() || compressed.getSize() != graph.getSize() || compressed.getIdBound() != graph.getIdBound())
+            return false;
+        bool isMatching = true;
+        for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+        {
+            isMatching &= compressed.containsVertex(id) == graph.containsVertex(id);
+            if (!graph.containsVertex(id))
+                continue;
+            isMatching &= compressed.getVertexName(id) == graph.getVertexName(id) && compressed.getVertexId(graph.getVertexName(id)) == id;
+            isMatching &= compressed.getOutDegree(id) == graph.getOutDegree(id);
+            isMatching &= TestGraphs::getEdges(compressed, id) == TestGraphs::getEdges(graph, id);
+        }
+        return isMatching;
+    }
+}
+
+TEST_CASE(compressRoundTripsNeighborsAndWeights)
+{
+    // Random weights, uniform weights, and weights needing several varint bytes.
+    for (const size_t maxWeight : { size_t(40), size_t(0), size_t(1) << 50 })
+    {
+        const GraphWD graph = TestGraphs::makeRandomGraph(300, 2500, maxWeight, 79);
+        CHECK(isMatchingGraph(graph.compress(), graph));
+    }
+    // A hub of more than 127 neighbors on both sides, a far first neighbor, and gaps needing several varint bytes.
+    GraphWD graph;
+    for (VertexId_t vertex = 0; vertex < 20000; ++vertex)
+        graph.insertVertex("v" + std::to_string(vertex));
+    for (VertexId_t vertex = 0; vertex < 20000; vertex += 50)
+        if (vertex != 10000)
+            graph.insertEdge(10000, vertex, vertex % 3 + 100);
+    graph.insertEdge(19999, 0, 7);
+    graph.insertEdge(0, 19999, 1000000);
+    graph.insertEdge(1, 2, 0);
+    CHECK(isMatchingGraph(graph.compress(), graph));
+    CHECK(GraphWD().compress().getOrder() == 0);
+}
+
+TEST_CASE(compressShrinksUniformWeights)
+{
+    const GraphWD uniform = TestGraphs::makeRandomGraph(500, 3000, 0, 83);
+    const GraphWD weighted = TestGraphs::makeRandomGraph(500, 3000, 1000, 83);
+    const CompressedGraphWD uniformCompressed = uniform.compress(), weightedCompressed = weighted.compress();
+    CHECK(uniformCompressed.getSize() == weightedCompressed.getSize());
+    // Weights of up to 1000 take two bytes per edge, and uniform weights none.
+    CHECK(uniformCompressed.getAdjacencyBytes() + uniformCompressed.getSize() < weightedCompressed.getAdjacencyBytes());
+    CHECK(uniformCompressed.getAdjacencyBytes() < 6 * uniformCompressed.getSize());
+}
+
+TEST_CASE(compressRunsTheAlgorithmsOfTheGraph)
+{
+    GraphWD graph = TestGraphs::makeRandomGraph(150, 700, 30, 89);
+    const CompressedGraphWD compressed = graph.compress();
+    for (VertexId_t source = 0; source < graph.getIdBound(); source += 6)
+    {
+        if (!graph.containsVertex(source))
+            continue;
+        const Vertex_t name = graph.getVertexName(source);
+        CHECK(compressed.getDijkstraShortestPaths(source) == graph.getDijkstraShortestPaths(source));
+        CHECK(compressed.getDijkstraShortestPaths(name) == graph.getDijkstraShortestPaths(name));
+        CHECK(compressed.getDijkstraShortestPath(source, 1).first == graph.getDijkstraShortestPath(source, 1).first);
+        CHECK(compressed.getDFS(name) == graph.getDFS(name));
+        CHECK(compressed.getBFS(source) == graph.getBFS(source));
+    }
+    CHECK(compressed.getKahnTopologicalSort() == graph.getKahnTopologicalSort());
+    CHECK_THROWS(compressed.getDijkstraShortestPaths(VertexId_t(5)));
+    CHECK_THROWS(compressed.getDFS("missing"));
+    CHECK_THROWS(compressed.getVertexId("v5"));
+    // The snapshot is a copy.
+    const GraphWD frozen = graph;
+    graph.removeVertex("v0");
+    graph.insertVertex("w");
+    graph.insertEdge("w", "v1", 0);
+    CHECK(isMatchingGraph(compressed, frozen));
+}
@@ -0,0 +1,231 @@
+/*
+    @file           ConcurrentGraphWDTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests the snapshot isolation and the all-or-nothing batches of `ConcurrentGraphWD`, with and without concurrent readers.
+*/
+
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "GraphWD.hpp"
+#include "ConcurrentGraphWD.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Checks whether two given graphs have the same vertex ids, names, edges and weights.
+    bool isSameGraph(const GraphWD& graph, const GraphWD& other)
+    {
+        if (graph.getOrder() != other.getOrder() || graph.getSize() != other.getSize() || graph.getIdBound() != other.getIdBound())
+            return false;
+        bool isSame = true;
+        for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+        {
+            if (!graph.containsVertex(id) || !other.containsVertex(id))
+            {
+                isSame &= graph.containsVertex(id) == other.containsVertex(id);
+                continue;
+            }
+            isSame &= graph.getVertexName(id) == other.getVertexName(id) && graph.getOutDegree(id) == other.getOutDegree(id);
+            graph.forEachNeighbor(id, [&](const VertexId_t neighbor, const size_t weight)
+                {
+                    isSame &= other.containsVertex(neighbor) && other.getWeight(id, neighbor) == weight;
+                });
+        }
+        return isSame;
+    }
+}
+
+TEST_CASE(concurrentGraphKeepsPinnedSnapshotsUnchanged)
+{
+    GraphWD graph;
+    graph.insertVertex("a");
+    graph.insertVertex("b");
+    graph.insertEdge("a", "b", 1);
+    ConcurrentGraphWD shared(graph);
+    const ConcurrentGraphWD::Snapshot first = shared.getSnapshot();
+    ConcurrentGraphWD::Batch batch;
+    batch.insertVertex("c").insertEdge("b", "c", 2).removeEdge("a", "b");
+    CHECK(batch.size() == 3);
+    shared.apply(batch);
+    const ConcurrentGraphWD::Snapshot second = shared.getSnapshot();
+    CHECK(isSameGraph(*first, graph));
+    CHECK(second->getOrder() == 3);
+    CHECK(second->getSize() == 1);
+    CHECK(second->getWeight("b", "c") == 2);
+    batch.clear();
+    CHECK(batch.empty());
+    shared.apply(batch.removeVertex("c"));
+    CHECK(isSameGraph(*first, graph));
+    CHECK(second->getOrder() == 3);
+    CHECK(shared.getSnapshot()->getOrder() == 2);
+}
+
+TEST_CASE(concurrentGraphDiscardsFailingBatches)
+{
+    ConcurrentGraphWD shared;
+    shared.apply(ConcurrentGraphWD::Batch().insertVertex("a").insertVertex("b"));
+    const ConcurrentGraphWD::Snapshot before = shared.getSnapshot();
+    ConcurrentGraphWD::Batch failing;
+    failing.insertVertex("c").insertEdge("a", "c", 1).insertEdge("a", "missing", 1);
+    CHECK_THROWS(shared.apply(failing));
+    CHECK(shared.getSnapshot() == before);
+    CHECK(!shared.getSnapshot()->containsVertex("c"));
+    shared.apply(ConcurrentGraphWD::Batch().insertEdge("a", "b", 4));
+    shared.apply(ConcurrentGraphWD::Batch().insertVertex("c"));
+    const ConcurrentGraphWD::Snapshot after = shared.getSnapshot();
+    CHECK(after->getSize() == 1);
+    CHECK(after->getOrder() == 3);
+    CHECK(after->getWeight("a", "b") == 4);
+}
+
+TEST_CASE(concurrentGraphMatchesSequentialMutationsOnRandomBatches)
+{
+    constexpr size_t VERTEX_NAMES = 30;
+    std::mt19937 generator(37);
+    std::uniform_int_distribution<size_t> pickVertex(0, VERTEX_NAMES - 1), pickWeight(1, 50), pickOperation(0, 9), pickLength(1, 6);
+    ConcurrentGraphWD shared;
+    GraphWD expected;
+    std::vector<ConcurrentGraphWD::Snapshot> pinned;
+    size_t failures = 0;
+    for (size_t step = 0; step < 400; ++step)
+    {
+        ConcurrentGraphWD::Batch batch;
+        GraphWD candidate = expected;
+        bool isFailing = false;
+        for (size_t length = pickLength(generator); length > 0; --length)
+        {
+            const Vertex_t source = "v" + std::to_string(pickVertex(generator)), destination = "v" + std::to_string(pickVertex(generator));
+            const size_t operation = pickOperation(generator), weight = pickWeight(generator);
+            try
+            {
+                if (operation < 3)
+                {
+                    batch.insertVertex(source);
+                    candidate.insertVertex(source);
+                }
+                else if (operation == 3)
+                {
+                    batch.removeVertex(source);
+                    candidate.removeVertex(source);
+                }
+                else if (operation < 8)
+                {
+                    batch.insertEdge(source, destination, weight);
+                    candidate.insertEdge(source, destination, weight);
+                }
+                else
+                {
+                    batch.removeEdge(source, destination);
+                    candidate.removeEdge(source, destination);
+                }
+            }
+            catch (const std::runtime_error&)
+            {
+                isFailing = true;
+            }
+        }
+        if (isFailing)
+        {
+            ++failures;
+            CHECK_THROWS(shared.apply(batch));
+        }
+        else
+        {
+            shared.apply(batch);
+            expected = std::move(candidate);
+        }
+        // Pinning snapshots now and then forces the next batches to copy the graph instead of replaying into the previous version.
+        if (step % 7 == 0)
+            pinned.push_back(shared.getSnapshot());
+        if (step % 11 == 0)
+            pinned.clear();
+        CHECK(isSameGraph(*shared.getSnapshot(), expected));
+    }
+    CHECK(failures > 0);
+}
+
+TEST_CASE(concurrentGraphServesConsistentSnapshotsToConcurrentReaders)
+{
+    constexpr size_t BATCHES = 300;
+    ConcurrentGraphWD shared;
+    shared.apply(ConcurrentGraphWD::Batch().insertVertex("v0"));
+    std::atomic<bool> isWriting = true;
+    std::atomic<size_t> inconsistencies = 0, reads = 0;
+    std::vector<std::thread> readers;
+    for (size_t reader = 0; reader < 4; ++reader)
+        readers.emplace_back([&]()
+            {
+                size_t lastOrder = 0;
+                do
+                {
+                    const ConcurrentGraphWD::Snapshot snapshot = shared.getSnapshot();
+                    // Every batch extends the chain `v0 -> v1 -> ...` by one vertex and one edge, so a snapshot never shows half a batch.
+                    const size_t order = snapshot->getOrder();
+                    if (order < lastOrder || snapshot->getSize() + 1 != order || snapshot->getDijkstraShortestPaths("v0").size() != order)
+                        ++inconsistencies;
+                    lastOrder = order;
+                    ++reads;
+                } while (isWriting.load());
+            });
+    for (size_t index = 1; index <= BATCHES; ++index)
+        shared.apply(ConcurrentGraphWD::Batch()
+            .insertVertex("v" + std::to_string(index))
+            .insertEdge("v" + std::to_string(index - 1), "v" + std::to_string(index), 1));
+    isWriting = false;
+    for (std::thread& reader : readers)
+        reader.join();
+    CHECK(inconsistencies == 0);
+    CHECK(reads >= readers.size());
+    const ConcurrentGraphWD::Snapshot last = shared.getSnapshot();
+    CHECK(last->getOrder() == BATCHES + 1);
+    CHECK(last->getDijkstraShortestPaths("v0").at("v" + std::to_string(BATCHES)) == BATCHES);
+}
+
+TEST_CASE(concurrentGraphKeepsSnapshotsPinnedAcrossConcurrentBatches)
+{
+    constexpr size_t BATCHES = 200;
+    ConcurrentGraphWD shared;
+    shared.apply(ConcurrentGraphWD::Batch().insertVertex("v0"));
+    std::atomic<bool> isWriting = true;
+    std::atomic<size_t> inconsistencies = 0;
+    std::vector<std::thread> readers;
+    for (size_t reader = 0; reader < 3; ++reader)
+        readers.emplace_back([&, reader]()
+            {
+                // Holding snapshots across batches forces the writer to copy into new or older versions, and to release the unpinned ones.
+                std::vector<ConcurrentGraphWD::Snapshot> held;
+                std::vector<size_t> orders;
+                for (size_t round = 0; isWriting.load() || round == 0; ++round)
+                {
+                    held.push_back(shared.getSnapshot());
+                    orders.push_back(held.back()->getOrder());
+                    ConcurrentGraphWD::Snapshot copy = held.front();
+                    copy = held.back();
+                    if (!(copy == held.back()) || copy->getSize() + 1 != copy->getOrder())
+                        ++inconsistencies;
+                    for (size_t index = 0; index < held.size(); ++index)
+                        if (held[index]->getOrder() != orders[index] || held[index]->getDijkstraShortestPaths("v0").size() != orders[index])
+                            ++inconsistencies;
+                    if (held.size() > 2 + reader)
+                    {
+                        held.erase(held.begin());
+                        orders.erase(orders.begin());
+                    }
+                    std::this_thread::yield();
+                }
+            });
+    for (size_t index = 1; index <= BATCHES; ++index)
+        shared.apply(ConcurrentGraphWD::Batch()
+            .insertVertex("v" + std::to_string(index))
+            .insertEdge("v" + std::to_string(index - 1), "v" + std::to_string(index), 1));
+    isWriting = false;
+    for (std::thread& reader : readers)
+        reader.join();
+    CHECK(inconsistencies == 0);
+    CHECK(shared.getSnapshot()->getOrder() == BATCHES + 1);
+}
@@ -0,0 +1,98 @@
+/*
+    @file           DeltaSteppingTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that `GraphWD::getDeltaSteppingShortestPaths` finds the distances of the sequential `getDijkstraShortestPaths`.
+*/
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include "GraphWD.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Creates a random graph of a given order and size, with weights up to a given bound, and with a tenth of its vertices removed.
+    GraphWD makeRandomGraph(const VertexId_t order, const size_t size, const size_t maxWeight, const unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<VertexId_t> pickVertex(0, order - 1);
+        std::uniform_int_distribution<size_t> pickWeight(0, maxWeight);
+        GraphWD graph;
+        for (VertexId_t vertex = 0; vertex < order; ++vertex)
+            graph.insertVertex("v" + std::to_string(vertex));
+        for (size_t edge = 0; edge < size; ++edge)
+        {
+            const VertexId_t source = pickVertex(generator), destination = pickVertex(generator);
+            if (source == destination)
+                continue;
+            try
+            {
+                graph.insertEdge(source, destination, pickWeight(generator));
+            }
+            catch (const std::runtime_error&)
+            {
+                // The edge already existed.
+            }
+        }
+        for (VertexId_t vertex = 0; vertex < order; vertex += 10)
+            graph.removeVertex(vertex + 5);
+        return graph;
+    }
+
+    //  @brief      Checks that delta-stepping finds the Dijkstra distances of a given graph from given sources, for every given delta and thread count.
+    bool isMatchingDijkstra(const GraphWD& graph, const std::vector<VertexId_t>& sources, const std::vector<size_t>& deltas,
+        const std::vector<unsigned>& threadCounts)
+    {
+        bool isMatching = true;
+        for (const VertexId_t source : sources)
+        {
+            const std::vector<size_t> expected = graph.getDijkstraShortestPaths(source);
+            for (const size_t delta : deltas)
+                for (const unsigned threads : threadCounts)
+                    isMatching &= graph.getDeltaSteppingShortestPaths(source, delta, threads) == expected;
+        }
+        return isMatching;
+    }
+}
+
+TEST_CASE(deltaSteppingMatchesDijkstraOnSmallGraphs)
+{
+    GraphWD graph;
+    for (const Vertex_t vertex : { "a", "b", "c", "d", "e" })
+        graph.insertVertex(vertex);
+    graph.insertEdge("a", "b", 10);
+    graph.insertEdge("a", "c", 3);
+    graph.insertEdge("c", "b", 4);
+    graph.insertEdge("b", "d", 0);
+    graph.insertEdge("c", "d", 8);
+    const std::map<Vertex_t, size_t> expected = { { "a", 0 }, { "b", 7 }, { "c", 3 }, { "d", 7 } };
+    CHECK(graph.getDijkstraShortestPaths("a") == expected);
+    for (const size_t delta : { 0, 1, 3, 100 })
+        CHECK(graph.getDeltaSteppingShortestPaths("a", delta, 2) == expected);
+    CHECK(graph.getDeltaSteppingShortestPaths("e", 0, 2) == (std::map<Vertex_t, size_t>{ { "e", 0 } }));
+    CHECK_THROWS(graph.getDeltaSteppingShortestPaths("f", 0, 2));
+}
+
+TEST_CASE(deltaSteppingMatchesDijkstraOnSparseRandomGraphs)
+{
+    const GraphWD graph = makeRandomGraph(300, 900, 100, 3);
+    CHECK(isMatchingDijkstra(graph, { 0, 1, 42, 299 }, { 0, 1, 7, 50, 1000 }, { 1, 2, 4 }));
+}
+
+TEST_CASE(deltaSteppingMatchesDijkstraOnDenseRandomGraphs)
+{
+    const GraphWD graph = makeRandomGraph(120, 4000, 1000, 5);
+    CHECK(isMatchingDijkstra(graph, { 0, 7, 119 }, { 0, 10, 250 }, { 1, 3, 8 }));
+}
+
+TEST_CASE(deltaSteppingMatchesDijkstraWithZeroAndEqualWeights)
+{
+    const GraphWD zeroWeights = makeRandomGraph(200, 800, 0, 9);
+    CHECK(isMatchingDijkstra(zeroWeights, { 0, 100 }, { 0, 1 }, { 1, 4 }));
+    const GraphWD lightWeights = makeRandomGraph(200, 800, 2, 9);
+    CHECK(isMatchingDijkstra(lightWeights, { 0, 100 }, { 0, 1, 2 }, { 1, 4 }));
+}
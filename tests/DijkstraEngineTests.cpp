@@ -0,0 +1,144 @@
+/*
+    @file           DijkstraEngineTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests `DijkstraEngine` against a quadratic reference Dijkstra: distances, early exit on targets, paths, and both queues.
+*/
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "GraphWD.hpp"
+#include "DijkstraEngine.hpp"
+#include "TestGraphs.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Computes the shortest distances from a given source of a given graph with the quadratic Dijkstra, without any queue.
+    std::vector<size_t> getReferenceDistances(const GraphWD& graph, const VertexId_t source)
+    {
+        std::vector<size_t> distances(graph.getIdBound(), SIZE_MAX);
+        std::vector<bool> isSettled(graph.getIdBound(), false);
+        distances[source] = 0;
+        while (true)
+        {
+            VertexId_t current = graph.getIdBound();
+            for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+                if (!isSettled[id] && distances[id] != SIZE_MAX && (current == graph.getIdBound() || distances[id] < distances[current]))
+                    current = id;
+            if (current == graph.getIdBound())
+                return distances;
+            isSettled[current] = true;
+            graph.forEachNeighbor(current, [&](const VertexId_t neighbor, const size_t weight)
+                {
+                    distances[neighbor] = std::min(distances[neighbor], distances[current] + weight);
+                });
+        }
+    }
+
+    //  @brief      Checks whether a given path of a given graph goes from a given source to a given target with a given length.
+    bool isPathValid(const GraphWD& graph, const std::vector<VertexId_t>& path, const VertexId_t source, const VertexId_t target, const size_t length)
+    {
+        if (path.empty() || path.front() != source || path.back() != target)
+            return false;
+        size_t total = 0;
+        for (size_t index = 1; index < path.size(); ++index)
+            total += graph.getWeight(path[index - 1], path[index]);
+        return total == length;
+    }
+
+    //  @brief      Checks whether a given engine matches the reference distances on every source of a given graph.
+    template <typename Queue>
+    bool isMatchingReference(DijkstraEngine<Queue>& engine, const GraphWD& graph)
+    {
+        bool isMatching = true;
+        for (VertexId_t source = 0; source < graph.getIdBound(); ++source)
+        {
+            if (!graph.containsVertex(source))
+                continue;
+            const std::vector<size_t> expected = getReferenceDistances(graph, source);
+            engine.run(graph, source);
+            size_t lastDistance = 0;
+            for (const VertexId_t settled : engine.getSettled())
+            {
+                isMatching &= engine.getDistance(settled) >= lastDistance;
+                lastDistance = engine.getDistance(settled);
+            }
+            for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+            {
+                isMatching &= engine.getDistance(id) == expected[id];
+                if (expected[id] != SIZE_MAX)
+                    isMatching &= isPathValid(graph, engine.getPath(id), source, id, expected[id]);
+                else
+                    isMatching &= engine.getPath(id).empty();
+            }
+        }
+        return isMatching;
+    }
+}
+
+TEST_CASE(dijkstraEngineMatchesTheReferenceWithBothQueues)
+{
+    DijkstraEngine<> dary;
+    DijkstraEngine<RadixHeap> radix;
+    for (const unsigned seed : { 1u, 2u, 3u })
+    {
+        // Zero weights, and graphs of decreasing id bounds, exercise the ties and the reuse of the engines.
+        const GraphWD graph = TestGraphs::makeRandomGraph(60 - 10 * seed, 250, seed == 2 ? 3 : 1000, seed);
+        CHECK(isMatchingReference(dary, graph));
+        CHECK(isMatchingReference(radix, graph));
+    }
+}
+
+TEST_CASE(dijkstraEngineStopsOnceEveryTargetIsSettled)
+{
+    GraphWD graph;
+    for (VertexId_t vertex = 0; vertex < 50; ++vertex)
+        graph.insertVertex("v" + std::to_string(vertex));
+    for (VertexId_t vertex = 1; vertex < 50; ++vertex)
+        graph.insertEdge(vertex - 1, vertex, 2);
+    graph.insertEdge(0, 30, 100);
+    DijkstraEngine<> engine;
+    engine.run(graph, 0, { 3 });
+    CHECK(engine.getDistance(3) == 6);
+    CHECK(engine.getSettled().size() <= 4);
+    CHECK(!engine.isSettled(10));
+    CHECK(engine.getDistance(10) == SIZE_MAX);
+    engine.run(graph, 0, { 30, 2 });
+    CHECK(engine.getDistance(30) == 60 && engine.getDistance(2) == 4);
+    CHECK(engine.getSettled().size() <= 31);
+    CHECK((engine.getPath(30) == graph.getDijkstraShortestPath(0, 30).second));
+    CHECK(!engine.isSettled(31));
+    engine.run(graph, 0);
+    CHECK(engine.getSettled().size() == 50);
+    CHECK(engine.getDistance(49) == 98);
+}
+
+TEST_CASE(dijkstraEngineTargetsMatchFullRuns)
+{
+    const GraphWD graph = TestGraphs::makeRandomGraph(80, 320, 50, 41);
+    DijkstraEngine<> full, early;
+    DijkstraEngine<RadixHeap> radix;
+    for (VertexId_t source = 0; source < graph.getIdBound(); source += 3)
+    {
+        if (!graph.containsVertex(source))
+            continue;
+        full.run(graph, source);
+        const std::vector<VertexId_t> targets = { 0, 1, 79 };
+        early.run(graph, source, targets);
+        radix.run(graph, source, targets);
+        // Only vertices up to the farthest target are settled, or every reachable vertex if a target is unreachable.
+        size_t farthest = 0;
+        for (const VertexId_t target : targets)
+        {
+            CHECK(early.getDistance(target) == full.getDistance(target));
+            CHECK(radix.getDistance(target) == full.getDistance(target));
+            farthest = std::max(farthest, full.getDistance(target));
+        }
+        for (const VertexId_t settled : early.getSettled())
+            CHECK(early.getDistance(settled) == full.getDistance(settled) && early.getDistance(settled) <= farthest);
+        CHECK((graph.getDijkstraShortestPaths(source, targets) == std::vector<size_t>{ full.getDistance(0), full.getDistance(1), full.getDistance(79) }));
+    }
+}
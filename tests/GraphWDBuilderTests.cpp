@@ -0,0 +1,187 @@
+/*
+    @file           GraphWDBuilderTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that `GraphWD::Builder` builds the graphs of incremental insertion, and applies its policies to edges and edge lists.
+*/
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "GraphWD.hpp"
+#include "GraphWDBuilder.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Checks whether two given graphs have the same vertex ids, names, edges and weights.
+    bool isSameGraph(const GraphWD& graph, const GraphWD& other)
+    {
+        if (graph.getOrder() != other.getOrder() || graph.getSize() != other.getSize() || graph.getIdBound() != other.getIdBound())
+            return false;
+        bool isSame = true;
+        for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+        {
+            if (!graph.containsVertex(id) || !other.containsVertex(id))
+            {
+                isSame &= graph.containsVertex(id) == other.containsVertex(id);
+                continue;
+            }
+            isSame &= graph.getVertexName(id) == other.getVertexName(id) && graph.getInDegree(id) == other.getInDegree(id);
+            graph.forEachNeighbor(id, [&](const VertexId_t neighbor, const size_t weight)
+                {
+                    isSame &= other.getWeight(id, neighbor) == weight;
+                });
+        }
+        return isSame;
+    }
+
+    //  @brief      Builds a graph with given policies from the single edge `a -> b` added with each of given weights.
+    GraphWD buildDuplicates(const GraphWD::Builder::DuplicatePolicy policy, const std::vector<size_t>& weights)
+    {
+        GraphWD::Builder builder;
+        builder.setDuplicatePolicy(policy);
+        for (const size_t weight : weights)
+            builder.addEdge("a", "b", weight);
+        return builder.build();
+    }
+}
+
+TEST_CASE(builderMatchesIncrementalInsertion)
+{
+    std::mt19937 generator(29);
+    std::uniform_int_distribution<size_t> pickVertex(0, 499), pickWeight(0, 100);
+    GraphWD incremental;
+    GraphWD::Builder builder;
+    builder.setThreads(4);
+    for (size_t edge = 0; edge < 5000; ++edge)
+    {
+        const Vertex_t source = "v" + std::to_string(pickVertex(generator)), destination = "v" + std::to_string(pickVertex(generator));
+        const size_t weight = pickWeight(generator);
+        builder.addEdge(source, destination, weight);
+        for (const Vertex_t& vertex : { source, destination })
+            if (!incremental.containsVertex(vertex))
+                incremental.insertVertex(vertex);
+        if (source == destination)
+            continue;
+        try
+        {
+            incremental.insertEdge(source, destination, weight);
+        }
+        catch (const std::runtime_error&)
+        {
+            // The edge already existed, and keeps its first weight.
+        }
+    }
+    builder.addVertex("isolated");
+    incremental.insertVertex("isolated");
+    const size_t selfLoops = builder.getReport().selfLoops;
+    const GraphWD built = builder.build();
+    CHECK(isSameGraph(built, incremental));
+    CHECK(builder.getReport().duplicates == 5000 - selfLoops - incremental.getSize());
+    CHECK(builder.build().getOrder() == 0);
+}
+
+TEST_CASE(builderAppliesDuplicatePolicies)
+{
+    typedef GraphWD::Builder::DuplicatePolicy Policy;
+    const std::vector<size_t> weights = { 5, 2, 9, 4 };
+    CHECK(buildDuplicates(Policy::KEEP_FIRST, weights).getWeight("a", "b") == 5);
+    CHECK(buildDuplicates(Policy::KEEP_LAST, weights).getWeight("a", "b") == 4);
+    CHECK(buildDuplicates(Policy::KEEP_MINIMUM, weights).getWeight("a", "b") == 2);
+    CHECK(buildDuplicates(Policy::KEEP_MAXIMUM, weights).getWeight("a", "b") == 9);
+    CHECK(buildDuplicates(Policy::THROW, { 5 }).getSize() == 1);
+    CHECK_THROWS(buildDuplicates(Policy::THROW, weights));
+}
+
+TEST_CASE(builderKeepsItsInputWhenRejectingDuplicates)
+{
+    GraphWD::Builder builder;
+    builder.setDuplicatePolicy(GraphWD::Builder::DuplicatePolicy::THROW);
+    builder.addEdge("a", "b", 3);
+    builder.addEdge("b", "c", 1);
+    builder.addEdge("a", "b", 1);
+    CHECK_THROWS(builder.build());
+    builder.setDuplicatePolicy(GraphWD::Builder::DuplicatePolicy::KEEP_MINIMUM);
+    const GraphWD graph = builder.build();
+    CHECK(graph.getSize() == 2);
+    CHECK(graph.getWeight("a", "b") == 1);
+    CHECK(builder.getReport().duplicates == 1);
+}
+
+TEST_CASE(builderAppliesSelfLoopPolicies)
+{
+    GraphWD::Builder builder;
+    builder.addEdge("a", "a", 1);
+    builder.addEdge("a", "b", 1);
+    CHECK(builder.getReport().selfLoops == 1);
+    builder.setSelfLoopPolicy(GraphWD::Builder::SelfLoopPolicy::THROW);
+    CHECK_THROWS(builder.addEdge("b", "b", 1));
+    std::istringstream input("c c 1\n");
+    CHECK_THROWS(builder.loadEdgeList(input));
+    const GraphWD graph = builder.build();
+    CHECK(graph.getSize() == 1);
+    CHECK(graph.getWeight("a", "b") == 1);
+    CHECK_THROWS(builder.addVertex("not valid"));
+}
+
+TEST_CASE(builderReportsRejectedEdgeListLines)
+{
+    std::istringstream input(
+        "# comment\n"
+        "% comment\n"
+        "\n"
+        "a b 1\n"
+        "a\tc\t2\r\n"
+        "   d   \n"
+        "a b\n"
+        "a b -1\n"
+        "a b x\n"
+        "a b 99999999999999999999999\n"
+        "a! b 1\n"
+        "a b 1 extra\n"
+        "c b 7");
+    GraphWD::Builder builder;
+    builder.loadEdgeList(input);
+    const GraphWD::Builder::Report& report = builder.getReport();
+    CHECK(report.lines == 10);
+    CHECK(report.rejectedLines == 6);
+    const GraphWD graph = builder.build();
+    CHECK(graph.getOrder() == 4);
+    CHECK(graph.getSize() == 3);
+    CHECK(graph.getWeight("a", "c") == 2);
+    CHECK(graph.getWeight("c", "b") == 7);
+    CHECK(graph.getOutDegree("d") == 0);
+}
+
+TEST_CASE(builderLoadsEdgeListsAcrossChunks)
+{
+    std::mt19937 generator(31);
+    std::uniform_int_distribution<size_t> pickVertex(0, 19999), pickWeight(0, 1000000);
+    std::string text;
+    GraphWD::Builder direct;
+    direct.setThreads(1);
+    for (size_t line = 0; line < 200000; ++line)
+    {
+        const Vertex_t source = "vertex" + std::to_string(pickVertex(generator));
+        const Vertex_t destination = "vertex" + std::to_string(pickVertex(generator));
+        const size_t weight = pickWeight(generator);
+        text += source + ' ' + destination + ' ' + std::to_string(weight) + '\n';
+        direct.addEdge(source, destination, weight);
+    }
+    const GraphWD expected = direct.build();
+    for (const unsigned threads : { 1, 4 })
+    {
+        std::istringstream input(text);
+        GraphWD::Builder builder;
+        builder.setThreads(threads).loadEdgeList(input);
+        CHECK(builder.getReport().lines == 200000);
+        CHECK(builder.getReport().rejectedLines == 0);
+        const GraphWD graph = builder.build();
+        CHECK(isSameGraph(graph, expected));
+        std::istringstream reloaded(text);
+        CHECK(isSameGraph(graph, GraphWD::loadEdgeList(reloaded)));
+    }
+}
@@ -0,0 +1,111 @@
+/*
+    @file           GraphWDStatsTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that the stats sink of `GraphWD` receives one report per successful instrumented call, with the expected counts,
+    @brief          when compiled with `GRAPH_WD_ENABLE_STATS` (`make test STATS=1`), and is never called otherwise.
+*/
+
+#include <string>
+#include <vector>
+#include <memory_resource>
+#include "GraphWD.hpp"
+#include "GraphWDStats.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Creates the graph `a -> b (1)`, `a -> c (5)`, `b -> c (1)`, of which the vertices get the ids 0, 1 and 2.
+    GraphWD makeTriangle(std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+    {
+        GraphWD graph(resource);
+        for (const Vertex_t vertex : { "a", "b", "c" })
+            graph.insertVertex(vertex);
+        graph.insertEdge("a", "b", 1);
+        graph.insertEdge("a", "c", 5);
+        graph.insertEdge("b", "c", 1);
+        return graph;
+    }
+}
+
+TEST_CASE(statsCountAllocationsOfTheCountingResource)
+{
+    GraphStats::CountingResource resource;
+    const GraphWD graph = makeTriangle(&resource);
+    const size_t allocations = resource.getAllocationCount();
+    CHECK(allocations > 0);
+    // Queries allocate their results from the default resource, not from the graph's.
+    graph.getDijkstraShortestPaths("a");
+    CHECK(resource.getAllocationCount() == allocations);
+}
+
+#ifdef GRAPH_WD_ENABLE_STATS
+TEST_CASE(statsReportTheWorkOfEachQuery)
+{
+    GraphWD graph = makeTriangle();
+    std::vector<GraphWD::Stats> reports;
+    graph.setStatsSink([&reports](const GraphWD::Stats& stats)
+        {
+            reports.push_back(stats);
+        });
+    graph.getDijkstraShortestPaths("a");
+    // `c` is pushed at 5 from `a`, then lowered to 2 from `b`: the indexed heap keeps no stale entry of it.
+    CHECK(reports.size() == 1);
+    CHECK(reports.back().operation == "getDijkstraShortestPaths");
+    CHECK(reports.back().settledVertices == 3 && reports.back().relaxedEdges == 3);
+    CHECK(reports.back().pushes == 4 && reports.back().stalePops == 0 && reports.back().peakFrontier == 2);
+    CHECK(reports.back().allocations == 0);
+    graph.getDFS(VertexId_t(1));
+    CHECK(reports.size() == 2 && reports.back().operation == "getDFS");
+    CHECK(reports.back().settledVertices == 2 && reports.back().relaxedEdges == 1 && reports.back().pushes == 2);
+    graph.getBFS("a");
+    CHECK(reports.size() == 3 && reports.back().operation == "getBFS");
+    CHECK(reports.back().settledVertices == 3 && reports.back().relaxedEdges == 3 && reports.back().peakFrontier == 2);
+    graph.getKahnTopologicalSort();
+    CHECK(reports.size() == 4 && reports.back().operation == "getKahnTopologicalSort");
+    CHECK(reports.back().settledVertices == 3 && reports.back().relaxedEdges == 3);
+}
+
+TEST_CASE(statsReportSuccessfulMutationsOnly)
+{
+    GraphStats::CountingResource resource;
+    GraphWD graph = makeTriangle(&resource);
+    std::vector<GraphWD::Stats> reports;
+    graph.setStatsSink([&reports](const GraphWD::Stats& stats)
+        {
+            reports.push_back(stats);
+        });
+    graph.insertVertex("d");
+    CHECK(reports.size() == 1 && reports.back().operation == "insertVertex" && reports.back().allocations > 0);
+    graph.insertEdge("c", "d", 2);
+    CHECK(reports.size() == 2 && reports.back().operation == "insertEdge" && reports.back().relaxedEdges == 1);
+    CHECK_THROWS(graph.insertEdge("c", "d", 3));
+    CHECK_THROWS(graph.insertVertex("a"));
+    CHECK_THROWS(graph.getDFS("missing"));
+    CHECK(reports.size() == 2);
+    graph.removeVertex("b");
+    CHECK(reports.size() == 3 && reports.back().operation == "removeVertex" && reports.back().relaxedEdges == 2);
+    graph.removeEdge("a", "c");
+    CHECK(reports.size() == 4 && reports.back().operation == "removeEdge" && reports.back().relaxedEdges == 1);
+    graph.setStatsSink(nullptr);
+    graph.getBFS("a");
+    CHECK(reports.size() == 4);
+}
+#else
+TEST_CASE(statsSinkIsNeverCalledWhenCompiledOut)
+{
+    GraphWD graph = makeTriangle();
+    size_t reportCount = 0;
+    graph.setStatsSink([&reportCount](const GraphWD::Stats&)
+        {
+            ++reportCount;
+        });
+    graph.insertVertex("d");
+    graph.insertEdge("c", "d", 2);
+    graph.getDijkstraShortestPaths("a");
+    graph.getBFS("a");
+    graph.removeVertex("b");
+    CHECK(reportCount == 0);
+}
+#endif // GRAPH_WD_ENABLE_STATS
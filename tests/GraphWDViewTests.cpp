@@ -0,0 +1,79 @@
+/*
+    @file           GraphWDViewTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that the compressed-sparse-row snapshots of `GraphWD::freeze` match the frozen graph, and ignore its later mutations.
+*/
+
+#include <string>
+#include <vector>
+#include "GraphWD.hpp"
+#include "GraphWDView.hpp"
+#include "TestGraphs.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Checks whether a given view has the vertex ids, names, neighbors and weights of a given graph, in the same order.
+    bool isMatchingGraph(const GraphWDView& view, const GraphWD& graph)
+    {
+        if (view.getOrder() != graph.getOrder() || view.getSize() != graph.getSize() || view.getIdBound() != graph.getIdBound())
+            return false;
+        bool isMatching = true;
+        for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+        {
+            isMatching &= view.containsVertex(id) == graph.containsVertex(id);
+            if (!graph.containsVertex(id))
+                continue;
+            isMatching &= view.getVertexName(id) == graph.getVertexName(id) && view.getVertexId(graph.getVertexName(id)) == id;
+            isMatching &= view.getOutDegree(graph.getVertexName(id)) == graph.getOutDegree(id);
+            isMatching &= TestGraphs::getEdges(view, id) == TestGraphs::getEdges(graph, id);
+        }
+        return isMatching;
+    }
+}
+
+TEST_CASE(freezeMatchesTheNeighborsAndWeightsOfTheGraph)
+{
+    const GraphWD graph = TestGraphs::makeRandomGraph(120, 700, 40, 3);
+    const GraphWDView view = graph.freeze();
+    CHECK(isMatchingGraph(view, graph));
+    CHECK(!view.containsVertex(graph.getIdBound()));
+    CHECK(!view.containsVertex(5));
+    CHECK_THROWS(view.getVertexId("v5"));
+    CHECK_THROWS(view.getVertexName(5));
+}
+
+TEST_CASE(freezeRunsTheAlgorithmsOfTheGraph)
+{
+    const GraphWD graph = TestGraphs::makeRandomGraph(80, 300, 25, 11);
+    const GraphWDView view = graph.freeze();
+    for (VertexId_t source = 0; source < graph.getIdBound(); source += 7)
+    {
+        if (!graph.containsVertex(source))
+            continue;
+        const Vertex_t name(graph.getVertexName(source));
+        CHECK(view.getDFS(source) == graph.getDFS(source));
+        CHECK(view.getBFS(name) == graph.getBFS(name));
+        CHECK(view.getDijkstraShortestPaths(source) == graph.getDijkstraShortestPaths(source));
+        CHECK(view.getDijkstraShortestPaths(name) == graph.getDijkstraShortestPaths(name));
+        CHECK(view.getDijkstraShortestPath(source, 0).first == graph.getDijkstraShortestPath(source, 0).first);
+    }
+    CHECK(view.getKahnTopologicalSort() == graph.getKahnTopologicalSort());
+}
+
+TEST_CASE(freezeIgnoresLaterMutationsOfTheGraph)
+{
+    GraphWD graph = TestGraphs::makeRandomGraph(50, 200, 9, 5);
+    const GraphWD frozen = graph;
+    const GraphWDView view = graph.freeze();
+    graph.removeVertex("v0");
+    graph.insertVertex("w");
+    graph.insertEdge("w", "v1", 3);
+    graph.removeVertex("v2");
+    CHECK(isMatchingGraph(view, frozen));
+    const GraphWDView copy = view;
+    CHECK(isMatchingGraph(copy, frozen));
+    CHECK(isMatchingGraph(graph.freeze(), graph));
+}
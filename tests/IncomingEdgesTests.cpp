@@ -0,0 +1,118 @@
+/*
+    @file           IncomingEdgesTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that the incoming-edge index of `GraphWD` keeps the in-degrees, the predecessors and the size right across removals.
+*/
+
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+#include "GraphWD.hpp"
+#include "TestGraphs.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Checks whether the in-degrees, the predecessors and the size of a given graph match a scan of its outgoing edges.
+    bool isIndexMatchingOutgoingEdges(const GraphWD& graph)
+    {
+        std::vector<std::vector<std::pair<VertexId_t, size_t>>> predecessors(graph.getIdBound());
+        size_t size = 0;
+        for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+            if (graph.containsVertex(id))
+                graph.forEachNeighbor(id, [&](const VertexId_t neighbor, const size_t weight)
+                    {
+                        predecessors[neighbor].emplace_back(id, weight);
+                        ++size;
+                    });
+        bool isMatching = size == graph.getSize();
+        for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+        {
+            if (!graph.containsVertex(id))
+            {
+                isMatching &= predecessors[id].empty();
+                continue;
+            }
+            std::vector<std::pair<VertexId_t, size_t>> indexed;
+            graph.forEachPredecessor(id, [&](const VertexId_t predecessor, const size_t weight)
+                {
+                    indexed.emplace_back(predecessor, weight);
+                });
+            isMatching &= indexed == predecessors[id] && graph.getInDegree(id) == predecessors[id].size();
+        }
+        return isMatching;
+    }
+}
+
+TEST_CASE(incomingEdgesFollowVertexRemovals)
+{
+    GraphWD graph;
+    for (const Vertex_t vertex : { "a", "b", "c", "d" })
+        graph.insertVertex(vertex);
+    graph.insertEdge("a", "b", 1);
+    graph.insertEdge("a", "c", 2);
+    graph.insertEdge("b", "c", 3);
+    graph.insertEdge("c", "d", 4);
+    graph.insertEdge("d", "b", 5);
+    CHECK(graph.getInDegree("c") == 2);
+    graph.removeVertex("b");
+    CHECK(graph.getSize() == 2);
+    CHECK(graph.getInDegree("c") == 1);
+    CHECK(graph.getOutDegree("d") == 0);
+    CHECK(isIndexMatchingOutgoingEdges(graph));
+    graph.insertVertex("e");
+    CHECK(graph.getInDegree("e") == 0);
+    graph.insertEdge("d", "e", 6);
+    CHECK(graph.getInDegree("e") == 1);
+    CHECK(isIndexMatchingOutgoingEdges(graph));
+}
+
+TEST_CASE(incomingEdgesMatchOutgoingEdgesOnRandomMutations)
+{
+    GraphWD graph = TestGraphs::makeRandomGraph(70, 350, 20, 23);
+    CHECK(isIndexMatchingOutgoingEdges(graph));
+    std::mt19937 generator(29);
+    std::uniform_int_distribution<VertexId_t> pickVertex(0, 69);
+    for (size_t step = 0; step < 200; ++step)
+    {
+        const Vertex_t source = "v" + std::to_string(pickVertex(generator)), destination = "v" + std::to_string(pickVertex(generator));
+        if (!graph.containsVertex(source))
+            graph.insertVertex(source);
+        else if (step % 5 == 0)
+            graph.removeVertex(source);
+        else if (graph.containsVertex(destination) && source != destination)
+            try
+            {
+                graph.removeEdge(source, destination);
+            }
+            catch (const std::runtime_error&)
+            {
+                graph.insertEdge(source, destination, step);
+            }
+    }
+    CHECK(isIndexMatchingOutgoingEdges(graph));
+}
+
+TEST_CASE(incomingEdgesDecideTreesAndTopologicalSorts)
+{
+    GraphWD graph;
+    for (const Vertex_t vertex : { "a", "b", "c", "d" })
+        graph.insertVertex(vertex);
+    graph.insertEdge("a", "b", 1);
+    graph.insertEdge("a", "c", 1);
+    graph.insertEdge("c", "d", 1);
+    CHECK((graph.isTree() == std::pair<bool, Vertex_t>{ true, "a" }));
+    graph.insertEdge("b", "d", 1);
+    CHECK(!graph.isTree().first);
+    CHECK((graph.getKahnTopologicalSort().second == std::vector<Vertex_t>{ "a", "b", "c", "d" }));
+    graph.insertEdge("d", "a", 1);
+    CHECK(!graph.getKahnTopologicalSort().first);
+    graph.removeVertex("a");
+    CHECK((graph.getKahnTopologicalSort().second == std::vector<Vertex_t>{ "b", "c", "d" }));
+    CHECK(!graph.isTree().first);
+    graph.removeVertex("c");
+    CHECK((graph.isTree() == std::pair<bool, Vertex_t>{ true, "b" }));
+}
@@ -0,0 +1,175 @@
+/*
+    @file           MemoryResourceTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that a graph constructed on a memory resource allocates its vertex and edge containers from it alone, with every
+    @brief          storage policy, and gives it all of its memory back.
+*/
+
+#include <new>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <memory_resource>
+#include "GraphWD.hpp"
+#include "BasicGraphWD.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    /*
+        @class      TrackingResource
+        @brief      Counts the allocations and the outstanding bytes of the memory it forwards to the new-delete resource.
+    */
+    class TrackingResource final : public std::pmr::memory_resource
+    {
+    private:
+        size_t allocationCount = 0;
+        size_t outstandingBytes = 0;
+
+        void* do_allocate(const size_t bytes, const size_t alignment) override
+        {
+            void* const pointer = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            ++this->allocationCount;
+            this->outstandingBytes += bytes;
+            return pointer;
+        }
+
+        void do_deallocate(void* const pointer, const size_t bytes, const size_t alignment) override
+        {
+            this->outstandingBytes -= bytes;
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    public:
+        size_t getAllocationCount(void) const noexcept
+        {
+            return this->allocationCount;
+        }
+
+        size_t getOutstandingBytes(void) const noexcept
+        {
+            return this->outstandingBytes;
+        }
+    };
+
+    /*
+        @class      DefaultResourceGuard
+        @brief      Replaces the default memory resource by a given one while it is alive, so that containers missing the resource of their graph are caught.
+    */
+    class DefaultResourceGuard final
+    {
+    private:
+        std::pmr::memory_resource* const previous;
+
+    public:
+        explicit DefaultResourceGuard(std::pmr::memory_resource* const resource) noexcept
+            : previous(std::pmr::set_default_resource(resource))
+        {
+        }
+
+        ~DefaultResourceGuard()
+        {
+            std::pmr::set_default_resource(this->previous);
+        }
+
+        DefaultResourceGuard(const DefaultResourceGuard&) = delete;
+        DefaultResourceGuard& operator=(const DefaultResourceGuard&) = delete;
+    };
+
+    /*
+        @brief      Builds, mutates and queries a graph of a given type on a given resource, while another resource is the default one.
+        @returns    `bool` Whether the graph allocated from its resource only, and gave all of its memory back once destroyed.
+    */
+    template <typename Graph>
+    bool isAllocatingFromItsResourceOnly(void)
+    {
+        TrackingResource resource, fallback;
+        {
+            const DefaultResourceGuard guard(&fallback);
+            Graph graph(&resource);
+            for (VertexId_t vertex = 0; vertex < 200; ++vertex)
+            {
+                if constexpr (Graph::IS_INTERNING)
+                    graph.insertVertex("v" + std::to_string(vertex));
+                else
+                    graph.insertVertex(vertex);
+            }
+            for (VertexId_t vertex = 0; vertex < 200; ++vertex)
+                for (const VertexId_t offset : { 1, 7, 31 })
+                    graph.insertEdge(vertex, (vertex + offset) % 200, vertex % 13);
+            for (VertexId_t vertex = 0; vertex < 200; vertex += 9)
+                graph.removeEdge(vertex, (vertex + 7) % 200);
+            for (VertexId_t vertex = 3; vertex < 200; vertex += 17)
+                graph.removeVertex(vertex);
+            if constexpr (Graph::IS_INTERNING)
+                graph.insertVertex("w");
+            else
+                graph.insertVertex(3);
+            graph.getDijkstraShortestPaths(0);
+            graph.getBFSTree(0, 1);
+            graph.getKahnTopologicalSort();
+            const bool isUsingResource = graph.getMemoryResource() == &resource && resource.getAllocationCount() > 0;
+            const Graph moved(std::move(graph));
+            if (!isUsingResource || moved.getMemoryResource() != &resource || fallback.getAllocationCount() != 0)
+                return false;
+        }
+        return resource.getOutstandingBytes() == 0 && fallback.getAllocationCount() == 0;
+    }
+}
+
+TEST_CASE(memoryResourceIsTheOnlyAllocatorOfEveryPolicy)
+{
+    CHECK(isAllocatingFromItsResourceOnly<GraphWD>());
+    CHECK((isAllocatingFromItsResourceOnly<BasicGraphWD<VertexId_t, std::uint32_t, MapStorage>>()));
+    CHECK((isAllocatingFromItsResourceOnly<BasicGraphWD<VertexId_t, std::uint32_t, SortedVectorStorage>>()));
+    CHECK((isAllocatingFromItsResourceOnly<BasicGraphWD<VertexId_t, std::uint32_t, HashMapStorage>>()));
+    CHECK((isAllocatingFromItsResourceOnly<BasicGraphWD<VertexId_t, std::uint32_t, CsrStorage>>()));
+    CHECK((isAllocatingFromItsResourceOnly<BasicGraphWD<Vertex_t, std::uint32_t, SortedVectorStorage>>()));
+}
+
+TEST_CASE(memoryResourceIsNotPropagatedToCopies)
+{
+    TrackingResource resource, fallback;
+    const DefaultResourceGuard guard(&fallback);
+    GraphWD graph(&resource);
+    graph.insertVertex("a");
+    graph.insertVertex("b");
+    graph.insertEdge("a", "b", 1);
+    const GraphWD copy = graph;
+    CHECK(copy.getMemoryResource() == &fallback);
+    CHECK(fallback.getAllocationCount() > 0);
+    CHECK(copy.getWeight("a", "b") == 1);
+}
+
+TEST_CASE(memoryResourceBoundsTheMemoryOfTheGraph)
+{
+    // A monotonic buffer without upstream fails once its buffer is exhausted, instead of falling back to the heap.
+    std::vector<std::byte> buffer(1 << 16);
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+    BasicGraphWD<VertexId_t, std::uint32_t, SortedVectorStorage> graph(&arena);
+    for (VertexId_t vertex = 0; vertex < 100; ++vertex)
+        graph.insertVertex(vertex);
+    for (VertexId_t vertex = 1; vertex < 100; ++vertex)
+        graph.insertEdge(vertex - 1, vertex, 1);
+    CHECK(graph.getDijkstraShortestPaths(0)[99] == 99);
+    bool isExhausted = false;
+    try
+    {
+        for (VertexId_t vertex = 100; ; ++vertex)
+            graph.insertVertex(vertex);
+    }
+    catch (const std::bad_alloc&)
+    {
+        isExhausted = true;
+    }
+    CHECK(isExhausted);
+    CHECK(graph.getSize() == 99 && graph.getDijkstraShortestPaths(0)[99] == 99);
+}
@@ -0,0 +1,101 @@
+/*
+    @file           ParallelQueriesTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that the batch and all-pairs queries of `GraphWD` match repeated single-source searches, and that the `ThreadPool`
+    @brief          running them supports nested `parallelFor` calls and propagates the exceptions of their tasks.
+*/
+
+#include <map>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include "GraphWD.hpp"
+#include "ThreadPool.hpp"
+#include "TestGraphs.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Gets the ids of the vertices of a given graph, every given stride.
+    std::vector<VertexId_t> getSources(const GraphWD& graph, const VertexId_t stride)
+    {
+        std::vector<VertexId_t> sources;
+        for (VertexId_t id = 0; id < graph.getIdBound(); id += stride)
+            if (graph.containsVertex(id))
+                sources.push_back(id);
+        return sources;
+    }
+}
+
+TEST_CASE(parallelBatchMatchesSingleSourceSearches)
+{
+    const GraphWD graph = TestGraphs::makeRandomGraph(90, 400, 30, 31);
+    const std::vector<VertexId_t> sources = getSources(graph, 3);
+    std::vector<Vertex_t> names;
+    for (const VertexId_t source : sources)
+        names.push_back(graph.getVertexName(source));
+    for (const unsigned threads : { 1u, 2u, 4u })
+    {
+        const std::vector<std::vector<size_t>> distances = graph.getShortestPathsBatch(sources, threads);
+        const std::vector<std::map<Vertex_t, size_t>> namedDistances = graph.getShortestPathsBatch(names, threads);
+        CHECK(distances.size() == sources.size() && namedDistances.size() == names.size());
+        for (size_t index = 0; index < sources.size(); ++index)
+        {
+            CHECK(distances[index] == graph.getDijkstraShortestPaths(sources[index]));
+            CHECK(namedDistances[index] == graph.getDijkstraShortestPaths(names[index]));
+        }
+    }
+    CHECK(graph.getShortestPathsBatch(std::vector<VertexId_t>{}, 2).empty());
+    CHECK_THROWS(graph.getShortestPathsBatch(std::vector<VertexId_t>{ 0, 5 }, 2));
+    CHECK_THROWS(graph.getShortestPathsBatch(std::vector<Vertex_t>{ "v0", "missing" }, 2));
+}
+
+TEST_CASE(parallelAllPairsMatchesSingleSourceSearches)
+{
+    const GraphWD graph = TestGraphs::makeRandomGraph(50, 220, 12, 37);
+    const VertexId_t bound = graph.getIdBound();
+    for (const unsigned threads : { 1u, 3u })
+    {
+        const std::vector<size_t> matrix = graph.getAllPairsShortestPaths(threads);
+        CHECK(matrix.size() == bound * bound);
+        for (VertexId_t source = 0; source < bound; ++source)
+        {
+            // The rows of removed vertices reach nothing.
+            const std::vector<size_t> expected = graph.containsVertex(source) ? graph.getDijkstraShortestPaths(source) : std::vector<size_t>(bound, SIZE_MAX);
+            CHECK((std::vector<size_t>(matrix.begin() + source * bound, matrix.begin() + (source + 1) * bound) == expected));
+        }
+    }
+    CHECK(GraphWD().getAllPairsShortestPaths(2).empty());
+}
+
+TEST_CASE(parallelForRunsNestedCallsAndRethrows)
+{
+    ThreadPool pool(2);
+    std::vector<std::atomic<size_t>> counts(64);
+    // Every outer task waits for an inner call, which deadlocks unless the waiting workers run the queued tasks.
+    pool.parallelFor(0, 8, 1, [&](const size_t outer)
+        {
+            pool.parallelFor(0, 8, 3, [&](const size_t inner)
+                {
+                    counts[outer * 8 + inner].fetch_add(1, std::memory_order_relaxed);
+                });
+        });
+    bool isEveryIndexRunOnce = true;
+    for (const std::atomic<size_t>& count : counts)
+        isEveryIndexRunOnce &= count.load() == 1;
+    CHECK(isEveryIndexRunOnce);
+    CHECK_THROWS(pool.parallelFor(0, 16, 2, [&](const size_t index)
+        {
+            if (index == 11)
+                throw std::runtime_error("Task failed");
+        }));
+    std::atomic<size_t> total{ 0 };
+    pool.parallelFor(0, 100, 7, [&](const size_t index)
+        {
+            total.fetch_add(index, std::memory_order_relaxed);
+        });
+    CHECK(total.load() == 4950);
+}
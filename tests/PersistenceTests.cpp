@@ -0,0 +1,204 @@
+/*
+    @file           PersistenceTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests the round-trip of `GraphWD::save` and `GraphWD::openMapped`, and the rejection of damaged files.
+*/
+
+#include <random>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <filesystem>
+#include "GraphWD.hpp"
+#include "GraphWDView.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @class      TemporaryDirectory
+    //  @brief      A uniquely named directory of the system temporary directory, removed with its files when destroyed.
+    class TemporaryDirectory final
+    {
+    private:
+        std::filesystem::path path;
+
+    public:
+        TemporaryDirectory(void)
+            : path(std::filesystem::temp_directory_path() / ("GraphWDTests." + std::to_string(std::random_device()())))
+        {
+            std::filesystem::create_directories(this->path);
+        }
+
+        TemporaryDirectory(const TemporaryDirectory& other) = delete;
+        TemporaryDirectory& operator=(const TemporaryDirectory& other) = delete;
+
+        ~TemporaryDirectory()
+        {
+            std::error_code error;
+            std::filesystem::remove_all(this->path, error);
+        }
+
+        //  @brief      Gets the path of a given file name in the directory.
+        std::string getFile(const std::string& name) const
+        {
+            return (this->path / name).string();
+        }
+
+        //  @brief      Counts the files of the directory.
+        size_t getFileCount(void) const
+        {
+            return static_cast<size_t>(std::distance(std::filesystem::directory_iterator(this->path), std::filesystem::directory_iterator()));
+        }
+    };
+
+    //  @brief      Reads the bytes of a given file.
+    std::string readBytes(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    //  @brief      Replaces the contents of a given file with given bytes.
+    void writeBytes(const std::string& path, const std::string& bytes)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    //  @brief      Creates a random graph of a given order and size, with some of its vertices removed so that its ids have holes.
+    GraphWD makeRandomGraph(const VertexId_t order, const size_t size, const unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<VertexId_t> pickVertex(0, order - 1);
+        std::uniform_int_distribution<size_t> pickWeight(0, 1000);
+        GraphWD graph;
+        for (VertexId_t vertex = 0; vertex < order; ++vertex)
+            graph.insertVertex("vertex" + std::to_string(vertex));
+        for (size_t edge = 0; edge < size; ++edge)
+        {
+            const VertexId_t source = pickVertex(generator), destination = pickVertex(generator);
+            if (source == destination)
+                continue;
+            try
+            {
+                graph.insertEdge(source, destination, pickWeight(generator));
+            }
+            catch (const std::runtime_error&)
+            {
+                // The edge already existed.
+            }
+        }
+        for (VertexId_t vertex = 3; vertex < order; vertex += 7)
+            graph.removeVertex(vertex);
+        return graph;
+    }
+
+    //  @brief      Checks whether a given view holds the vertices, names, edges and distances of a given graph.
+    bool isMatchingGraph(const GraphWDView& view, const GraphWD& graph)
+    {
+        if (view.getOrder() != graph.getOrder() || view.getSize() != graph.getSize() || view.getIdBound() != graph.getIdBound())
+            return false;
+        bool isMatching = true;
+        for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+        {
+            isMatching &= view.containsVertex(id) == graph.containsVertex(id);
+            if (!graph.containsVertex(id))
+                continue;
+            const Vertex_t name = graph.getVertexName(id);
+            isMatching &= Vertex_t(view.getVertexName(id)) == name && view.getVertexId(name) == id
+                && view.getOutDegree(name) == graph.getOutDegree(name);
+            graph.forEachNeighbor(id, [&](const VertexId_t neighbor, const size_t weight)
+                {
+                    bool isFound = false;
+                    view.forEachNeighbor(id, [&](const VertexId_t viewNeighbor, const size_t viewWeight)
+                        {
+                            isFound |= viewNeighbor == neighbor && viewWeight == weight;
+                        });
+                    isMatching &= isFound;
+                });
+            if (id % 5 == 0)
+                isMatching &= view.getDijkstraShortestPaths(id) == graph.getDijkstraShortestPaths(id);
+        }
+        return isMatching;
+    }
+}
+
+TEST_CASE(persistenceRoundTripsGraphsWithRemovedVertices)
+{
+    const TemporaryDirectory directory;
+    const std::string path = directory.getFile("graph.gwd");
+    const GraphWD graph = makeRandomGraph(200, 1500, 13);
+    graph.save(path);
+    CHECK(isMatchingGraph(GraphWD::openMapped(path), graph));
+    CHECK(isMatchingGraph(GraphWD::openMapped(path, false), graph));
+    CHECK(directory.getFileCount() == 1);
+}
+
+TEST_CASE(persistenceRoundTripsEmptyAndEdgelessGraphs)
+{
+    const TemporaryDirectory directory;
+    const std::string path = directory.getFile("graph.gwd");
+    GraphWD graph;
+    graph.save(path);
+    CHECK(isMatchingGraph(GraphWD::openMapped(path), graph));
+    graph.insertVertex("a");
+    graph.insertVertex("b");
+    graph.removeVertex("a");
+    graph.save(path);
+    const GraphWDView view = GraphWD::openMapped(path);
+    CHECK(isMatchingGraph(view, graph));
+    CHECK(!view.containsVertex(0));
+}
+
+TEST_CASE(persistenceRejectsMissingAndForeignFiles)
+{
+    const TemporaryDirectory directory;
+    CHECK_THROWS(GraphWD::openMapped(directory.getFile("missing.gwd")));
+    writeBytes(directory.getFile("empty.gwd"), "");
+    CHECK_THROWS(GraphWD::openMapped(directory.getFile("empty.gwd")));
+    writeBytes(directory.getFile("text.gwd"), std::string(256, 'x'));
+    CHECK_THROWS(GraphWD::openMapped(directory.getFile("text.gwd"), false));
+}
+
+TEST_CASE(persistenceRejectsDamagedFiles)
+{
+    const TemporaryDirectory directory;
+    const std::string path = directory.getFile("graph.gwd");
+    makeRandomGraph(50, 200, 17).save(path);
+    const std::string bytes = readBytes(path);
+    std::string damaged = bytes;
+    damaged[8] = static_cast<char>(damaged[8] + 1); // The format version.
+    writeBytes(path, damaged);
+    CHECK_THROWS(GraphWD::openMapped(path, false));
+    damaged = bytes;
+    damaged[bytes.size() / 2] = static_cast<char>(~damaged[bytes.size() / 2]);
+    writeBytes(path, damaged);
+    CHECK_THROWS(GraphWD::openMapped(path));
+    writeBytes(path, bytes.substr(0, bytes.size() - 8));
+    CHECK_THROWS(GraphWD::openMapped(path));
+    CHECK_THROWS(GraphWD::openMapped(path, false));
+    writeBytes(path, bytes + std::string(8, '\0'));
+    CHECK_THROWS(GraphWD::openMapped(path, false));
+    writeBytes(path, bytes);
+    CHECK(GraphWD::openMapped(path).getOrder() == 50 - 7);
+}
+
+TEST_CASE(persistenceReplacesFilesAtomically)
+{
+    const TemporaryDirectory directory;
+    const std::string path = directory.getFile("graph.gwd");
+    const GraphWD first = makeRandomGraph(60, 300, 19), second = makeRandomGraph(90, 500, 23);
+    first.save(path);
+    const GraphWDView firstView = GraphWD::openMapped(path);
+    second.save(path);
+    // The view keeps mapping the replaced file, which is unlinked but never overwritten.
+    CHECK(isMatchingGraph(firstView, first));
+    CHECK(isMatchingGraph(GraphWD::openMapped(path), second));
+    CHECK(directory.getFileCount() == 1);
+    CHECK_THROWS(second.save(directory.getFile("missing/graph.gwd")));
+    CHECK(directory.getFileCount() == 1);
+    CHECK(isMatchingGraph(GraphWD::openMapped(path), second));
+}
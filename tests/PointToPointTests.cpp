@@ -0,0 +1,111 @@
+/*
+    @file           PointToPointTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that the bidirectional Dijkstra and the ALT-guided A* point-to-point queries of `GraphWD` match `getDijkstraShortestPaths`,
+    @brief          including once edits left the landmarks stale.
+*/
+
+#include <string>
+#include <vector>
+#include <utility>
+#include "GraphWD.hpp"
+#include "TestGraphs.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Checks whether a given path of a given graph goes from a given source to a given target with a given length.
+    bool isPathValid(const GraphWD& graph, const std::vector<VertexId_t>& path, const VertexId_t source, const VertexId_t target, const size_t length)
+    {
+        if (length == SIZE_MAX)
+            return path.empty();
+        if (path.empty() || path.front() != source || path.back() != target)
+            return false;
+        size_t total = 0;
+        for (size_t index = 1; index < path.size(); ++index)
+            total += graph.getWeight(path[index - 1], path[index]);
+        return total == length;
+    }
+
+    //  @brief      Checks whether the point-to-point queries of a given graph match Dijkstra between every pair of some sources and all vertices.
+    bool arePointToPointQueriesMatchingDijkstra(const GraphWD& graph, const VertexId_t sourceStride)
+    {
+        bool isMatching = true;
+        for (VertexId_t source = 0; source < graph.getIdBound(); source += sourceStride)
+        {
+            if (!graph.containsVertex(source))
+                continue;
+            const std::vector<size_t> expected = graph.getDijkstraShortestPaths(source);
+            for (VertexId_t target = 0; target < graph.getIdBound(); ++target)
+            {
+                if (!graph.containsVertex(target))
+                    continue;
+                const auto [bidirectionalDistance, bidirectionalPath] = graph.getBidirectionalShortestPath(source, target);
+                const auto [aStarDistance, aStarPath] = graph.getAStarShortestPath(source, target);
+                isMatching &= bidirectionalDistance == expected[target] && isPathValid(graph, bidirectionalPath, source, target, expected[target]);
+                isMatching &= aStarDistance == expected[target] && isPathValid(graph, aStarPath, source, target, expected[target]);
+            }
+        }
+        return isMatching;
+    }
+}
+
+TEST_CASE(pointToPointQueriesMatchDijkstra)
+{
+    for (const unsigned seed : { 4u, 8u })
+    {
+        GraphWD graph = TestGraphs::makeRandomGraph(70, 260, seed == 4 ? 2 : 60, seed);
+        CHECK(arePointToPointQueriesMatchingDijkstra(graph, 4));
+        graph.buildLandmarks(4);
+        CHECK(graph.areLandmarksUpToDate());
+        CHECK(graph.getLandmarks().size() == 4);
+        CHECK(arePointToPointQueriesMatchingDijkstra(graph, 4));
+    }
+}
+
+TEST_CASE(pointToPointQueriesHandleUnreachableAndMissingVertices)
+{
+    GraphWD graph;
+    for (const Vertex_t vertex : { "a", "b", "c" })
+        graph.insertVertex(vertex);
+    graph.insertEdge("a", "b", 0);
+    graph.setLandmarks(std::vector<Vertex_t>{ "b" });
+    CHECK((graph.getBidirectionalShortestPath("a", "b") == std::pair<size_t, std::vector<Vertex_t>>{ 0, { "a", "b" } }));
+    CHECK((graph.getAStarShortestPath("a", "a") == std::pair<size_t, std::vector<Vertex_t>>{ 0, { "a" } }));
+    CHECK(graph.getBidirectionalShortestPath("b", "a").first == SIZE_MAX);
+    CHECK(graph.getAStarShortestPath("a", "c").second.empty());
+    CHECK_THROWS(graph.getAStarShortestPath("a", "missing"));
+    CHECK_THROWS(graph.getBidirectionalShortestPath("missing", "a"));
+    CHECK_THROWS(graph.setLandmarks(std::vector<Vertex_t>{ "missing" }));
+}
+
+TEST_CASE(aStarStaysExactWithStaleLandmarks)
+{
+    GraphWD graph = TestGraphs::makeRandomGraph(60, 240, 50, 12);
+    graph.buildLandmarks(3);
+    const std::vector<Vertex_t> landmarks = graph.getLandmarks();
+    // Shortcuts shorten distances below the stale lower bounds, which would make a guided search inexact.
+    for (VertexId_t source = 0; source + 20 < graph.getIdBound(); source += 6)
+        if (graph.containsVertex(source) && graph.containsVertex(source + 20))
+        {
+            try
+            {
+                graph.removeEdge(source, source + 20);
+            }
+            catch (const std::runtime_error&)
+            {
+                // The shortcut is new.
+            }
+            graph.insertEdge(source, source + 20, 0);
+        }
+    graph.removeVertex(landmarks.front());
+    CHECK(!graph.areLandmarksUpToDate());
+    CHECK(graph.getLandmarks().size() == landmarks.size() - 1);
+    CHECK(arePointToPointQueriesMatchingDijkstra(graph, 3));
+    graph.rebuildLandmarks();
+    CHECK(graph.areLandmarksUpToDate());
+    CHECK((graph.getLandmarks() == std::vector<Vertex_t>(landmarks.begin() + 1, landmarks.end())));
+    CHECK(arePointToPointQueriesMatchingDijkstra(graph, 3));
+}
@@ -0,0 +1,200 @@
+/*
+    @file           ShortestPathCacheTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests which trees the shortest path cache of `GraphWD` keeps and drops on mutations, see `setShortestPathCache`.
+*/
+
+#include <tuple>
+#include <random>
+#include <string>
+#include <vector>
+#include "GraphWD.hpp"
+#include "DijkstraEngine.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      The byte limit of the tests not exercising it, large enough for any of their trees.
+    constexpr size_t UNLIMITED_BYTES = 1 << 20;
+
+    //  @brief      Creates a graph of given vertices and edges `{ source, destination, weight }`, caching up to a given number of trees.
+    GraphWD makeCachedGraph(const std::vector<Vertex_t>& vertices, const std::vector<std::tuple<Vertex_t, Vertex_t, size_t>>& edges,
+        const size_t maxEntries = 8)
+    {
+        GraphWD graph;
+        for (const Vertex_t& vertex : vertices)
+            graph.insertVertex(vertex);
+        for (const auto& [source, destination, weight] : edges)
+            graph.insertEdge(source, destination, weight);
+        graph.setShortestPathCache(maxEntries, UNLIMITED_BYTES);
+        return graph;
+    }
+
+    //  @brief      Computes the shortest distances from a given source without going through the cache, indexed by vertex id.
+    std::vector<size_t> getUncachedDistances(const GraphWD& graph, const VertexId_t source)
+    {
+        DijkstraEngine<> engine;
+        engine.run(graph, source);
+        std::vector<size_t> distances(graph.getIdBound(), SIZE_MAX);
+        for (const VertexId_t vertex : engine.getSettled())
+            distances[vertex] = engine.getDistance(vertex);
+        return distances;
+    }
+}
+
+TEST_CASE(shortestPathCacheCountsHitsAndMisses)
+{
+    GraphWD graph = makeCachedGraph({ "a", "b", "c" }, { { "a", "b", 2 }, { "b", "c", 3 } });
+    CHECK(graph.getDijkstraShortestPaths("a").at("c") == 5);
+    CHECK(graph.getDijkstraShortestPaths("a").at("c") == 5);
+    CHECK(graph.getDijkstraShortestPaths("a", std::vector<Vertex_t>{ "b" }).at("b") == 2);
+    GraphWD::CacheCounters counters = graph.getShortestPathCacheCounters();
+    CHECK(counters.misses == 1);
+    CHECK(counters.hits == 2);
+    CHECK(counters.entries == 1);
+    CHECK(counters.bytes > 0);
+    graph.clearShortestPathCache();
+    counters = graph.getShortestPathCacheCounters();
+    CHECK(counters.entries == 0);
+    CHECK(counters.hits == 2);
+    graph.setShortestPathCache(0, 0);
+    CHECK(graph.getDijkstraShortestPaths("a").at("c") == 5);
+    CHECK(graph.getShortestPathCacheCounters().misses == 0);
+}
+
+TEST_CASE(shortestPathCacheKeepsTreesOnNonShorteningEdgeInsertions)
+{
+    GraphWD graph = makeCachedGraph({ "a", "b", "c", "d" }, { { "a", "b", 1 }, { "b", "c", 1 } });
+    graph.getDijkstraShortestPaths("a");
+    // `a -> c` of weight 5 is longer than `a -> b -> c`, and `d` is not reached from `a`.
+    graph.insertEdge("a", "c", 5);
+    graph.insertEdge("d", "c", 1);
+    CHECK(graph.getDijkstraShortestPaths("a").at("c") == 2);
+    const GraphWD::CacheCounters counters = graph.getShortestPathCacheCounters();
+    CHECK(counters.invalidations == 0);
+    CHECK(counters.hits == 1);
+}
+
+TEST_CASE(shortestPathCacheDropsTreesOnShorteningEdgeInsertions)
+{
+    GraphWD graph = makeCachedGraph({ "a", "b", "c", "d" }, { { "a", "b", 1 }, { "b", "c", 1 }, { "a", "d", 5 } });
+    graph.getDijkstraShortestPaths("a");
+    graph.getDijkstraShortestPaths("b");
+    graph.getDijkstraShortestPaths("d");
+    // `c -> d` shortens `a -> d` to 3 and makes `d` reachable from `b`, but `d` does not reach `c`.
+    graph.insertEdge("c", "d", 1);
+    CHECK(graph.getShortestPathCacheCounters().invalidations == 2);
+    CHECK(graph.getDijkstraShortestPaths("a").at("d") == 3);
+    CHECK(graph.getDijkstraShortestPaths("b").at("d") == 2);
+    CHECK(graph.getDijkstraShortestPaths("d").size() == 1);
+    const GraphWD::CacheCounters counters = graph.getShortestPathCacheCounters();
+    CHECK(counters.misses == 5);
+    CHECK(counters.hits == 1);
+}
+
+TEST_CASE(shortestPathCacheKeepsTreesOnUnusedEdgeRemovals)
+{
+    GraphWD graph = makeCachedGraph({ "a", "b", "c" }, { { "a", "b", 1 }, { "b", "c", 1 }, { "a", "c", 5 } });
+    graph.getDijkstraShortestPaths("a");
+    graph.removeEdge("a", "c");
+    CHECK(graph.getDijkstraShortestPaths("a").at("c") == 2);
+    const GraphWD::CacheCounters counters = graph.getShortestPathCacheCounters();
+    CHECK(counters.invalidations == 0);
+    CHECK(counters.hits == 1);
+}
+
+TEST_CASE(shortestPathCacheDropsTreesOnUsedEdgeRemovals)
+{
+    GraphWD graph = makeCachedGraph({ "a", "b", "c" }, { { "a", "b", 1 }, { "b", "c", 1 } });
+    graph.getDijkstraShortestPaths("a");
+    graph.removeEdge("b", "c");
+    CHECK(graph.getShortestPathCacheCounters().invalidations == 1);
+    CHECK(!graph.getDijkstraShortestPaths("a").contains("c"));
+    CHECK(graph.getShortestPathCacheCounters().hits == 0);
+}
+
+TEST_CASE(shortestPathCacheFollowsVertexInsertionsAndRemovals)
+{
+    GraphWD graph = makeCachedGraph({ "a", "b", "c", "d" }, { { "a", "b", 1 }, { "b", "c", 1 }, { "d", "a", 1 } });
+    graph.getDijkstraShortestPaths("a");
+    graph.insertVertex("e");
+    graph.removeVertex("d");
+    CHECK(graph.getShortestPathCacheCounters().invalidations == 0);
+    CHECK(graph.getDijkstraShortestPaths("a").size() == 3);
+    CHECK(graph.getShortestPathCacheCounters().hits == 1);
+    graph.removeVertex("c");
+    CHECK(graph.getShortestPathCacheCounters().invalidations == 1);
+    CHECK(graph.getDijkstraShortestPaths("a").size() == 2);
+}
+
+TEST_CASE(shortestPathCacheEvictsLeastRecentlyUsedTrees)
+{
+    GraphWD graph = makeCachedGraph({ "a", "b", "c" }, { { "a", "b", 1 }, { "b", "c", 1 } }, 2);
+    graph.getDijkstraShortestPaths("a");
+    graph.getDijkstraShortestPaths("b");
+    graph.getDijkstraShortestPaths("a");
+    graph.getDijkstraShortestPaths("c");
+    GraphWD::CacheCounters counters = graph.getShortestPathCacheCounters();
+    CHECK(counters.evictions == 1);
+    CHECK(counters.entries == 2);
+    // `b` was the least recently used tree when `c` was cached.
+    graph.getDijkstraShortestPaths("a");
+    CHECK(graph.getShortestPathCacheCounters().hits == 2);
+    graph.getDijkstraShortestPaths("b");
+    counters = graph.getShortestPathCacheCounters();
+    CHECK(counters.misses == 4);
+    CHECK(counters.evictions == 2);
+    const size_t treeBytes = counters.bytes / counters.entries;
+    graph.setShortestPathCache(8, treeBytes);
+    graph.getDijkstraShortestPaths("a");
+    graph.getDijkstraShortestPaths("b");
+    counters = graph.getShortestPathCacheCounters();
+    CHECK(counters.entries == 1);
+    CHECK(counters.evictions == 1);
+    graph.setShortestPathCache(8, treeBytes - 1);
+    graph.getDijkstraShortestPaths("a");
+    CHECK(graph.getShortestPathCacheCounters().entries == 0);
+}
+
+TEST_CASE(shortestPathCacheMatchesUncachedDijkstraOnRandomMutations)
+{
+    constexpr VertexId_t ORDER = 40;
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<VertexId_t> pickVertex(0, ORDER - 1);
+    std::uniform_int_distribution<size_t> pickWeight(1, 20), pickMutation(0, 9);
+    GraphWD graph;
+    for (VertexId_t vertex = 0; vertex < ORDER; ++vertex)
+        graph.insertVertex("v" + std::to_string(vertex));
+    graph.setShortestPathCache(16, UNLIMITED_BYTES);
+    for (size_t step = 0; step < 1500; ++step)
+    {
+        const VertexId_t source = pickVertex(generator), destination = pickVertex(generator);
+        const size_t mutation = pickMutation(generator);
+        if (!graph.containsVertex(source))
+            graph.insertVertex("w" + std::to_string(step));
+        else if (mutation == 0)
+            graph.removeVertex(source);
+        else if (graph.containsVertex(destination) && source != destination)
+        {
+            try
+            {
+                if (mutation < 4)
+                    graph.removeEdge(source, destination);
+                else
+                    graph.insertEdge(source, destination, pickWeight(generator));
+            }
+            catch (const std::runtime_error&)
+            {
+                // The edge did not exist or already existed.
+            }
+        }
+        for (size_t query = 0; query < 3; ++query)
+            if (const VertexId_t querySource = pickVertex(generator); graph.containsVertex(querySource))
+                CHECK(graph.getDijkstraShortestPaths(querySource) == getUncachedDistances(graph, querySource));
+    }
+    const GraphWD::CacheCounters counters = graph.getShortestPathCacheCounters();
+    CHECK(counters.hits > 0);
+    CHECK(counters.invalidations > 0);
+}
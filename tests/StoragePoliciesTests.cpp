@@ -0,0 +1,342 @@
+/*
+    @file           StoragePoliciesTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that `BasicGraphWD` gives the results of `GraphWD` with every storage policy, integral and interned vertices alike,
+    @brief          across the same mutations, and that a failed `insertVertex` leaves the graph unchanged.
+*/
+
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <memory_resource>
+#include "GraphWD.hpp"
+#include "BasicGraphWD.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @struct     Operation
+    //  @brief      A mutation that succeeded on the reference graph, of which the inserted vertex got the id `source`.
+    struct Operation
+    {
+        enum class Kind { InsertVertex, RemoveVertex, InsertEdge, RemoveEdge } kind;
+        VertexId_t source;
+        VertexId_t destination;
+        size_t weight;
+        Vertex_t name;
+    };
+
+    //  @struct     Description
+    //  @brief      The results of a graph that do not depend on the order in which its storage visits the edges.
+    struct Description
+    {
+        size_t order = 0;
+        size_t size = 0;
+        std::vector<std::vector<std::pair<VertexId_t, size_t>>> edges;
+        std::vector<size_t> inDegrees;
+        std::vector<std::vector<size_t>> distances;
+        std::vector<std::vector<size_t>> depths;
+        std::vector<std::vector<VertexId_t>> reachable;
+        bool isAcyclic = false;
+
+        bool operator==(const Description&) const = default;
+    };
+
+    //  @struct     Traversals
+    //  @brief      The results of a graph that follow the order in which its storage visits the edges, increasing ids for ordered storages.
+    struct Traversals
+    {
+        std::vector<std::vector<VertexId_t>> dfs;
+        std::vector<std::vector<VertexId_t>> bfs;
+        std::vector<VertexId_t> topologicalSort;
+
+        bool operator==(const Traversals&) const = default;
+    };
+
+    //  @brief      Gets the ids of given vertices of a given graph, which are the vertices themselves for integral vertices.
+    template <typename Graph, typename VertexT>
+    std::vector<VertexId_t> toIds(const Graph& graph, const std::vector<VertexT>& vertices)
+    {
+        if constexpr (std::is_same_v<VertexT, VertexId_t>)
+            return vertices;
+        else
+        {
+            std::vector<VertexId_t> ids;
+            for (const VertexT& vertex : vertices)
+                ids.push_back(graph.getVertexId(vertex));
+            return ids;
+        }
+    }
+
+    //  @brief      Creates mutations of a graph of a given order, keeping the ones that succeed on a given reference graph, which they are applied to.
+    std::vector<Operation> makeOperations(GraphWD& reference, const VertexId_t order, const size_t count, const unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<VertexId_t> pickVertex(0, order - 1);
+        std::uniform_int_distribution<size_t> pickWeight(0, 20), pickKind(0, 19);
+        std::vector<Operation> operations;
+        for (VertexId_t vertex = 0; vertex < order; ++vertex)
+        {
+            const Vertex_t name = "v" + std::to_string(vertex);
+            operations.push_back({ Operation::Kind::InsertVertex, reference.insertVertex(name), 0, 0, name });
+        }
+        for (size_t step = 0; step < count; ++step)
+        {
+            const size_t kind = pickKind(generator);
+            Operation operation{ Operation::Kind::InsertEdge, pickVertex(generator), pickVertex(generator), pickWeight(generator), "" };
+            try
+            {
+                if (kind < 12)
+                    reference.insertEdge(operation.source, operation.destination, operation.weight);
+                else if (kind < 16)
+                {
+                    // Removes an existing edge of the source, if any, rather than a random pair that likely does not exist.
+                    operation.kind = Operation::Kind::RemoveEdge;
+                    reference.forEachNeighbor(operation.source, [&operation](const VertexId_t neighbor, const size_t)
+                        {
+                            operation.destination = neighbor;
+                        });
+                    reference.removeEdge(operation.source, operation.destination);
+                }
+                else if (kind < 18)
+                {
+                    operation.kind = Operation::Kind::RemoveVertex;
+                    reference.removeVertex(operation.source);
+                }
+                else
+                {
+                    operation.kind = Operation::Kind::InsertVertex;
+                    operation.name = "w" + std::to_string(step);
+                    operation.source = reference.insertVertex(operation.name);
+                }
+                operations.push_back(operation);
+            }
+            catch (const std::runtime_error&)
+            {
+                // Self-loops, duplicate edges and missing vertices are skipped.
+            }
+        }
+        return operations;
+    }
+
+    //  @brief      Applies given mutations to a given graph, and checks that each one succeeds and that inserted vertices get the same ids.
+    template <typename Graph>
+    bool applyOperations(Graph& graph, const std::vector<Operation>& operations)
+    {
+        bool isMatching = true;
+        for (const Operation& operation : operations)
+            try
+            {
+                switch (operation.kind)
+                {
+                case Operation::Kind::InsertVertex:
+                    if constexpr (Graph::IS_INTERNING)
+                        isMatching &= graph.insertVertex(operation.name) == operation.source;
+                    else
+                        isMatching &= graph.insertVertex(operation.source) == operation.source;
+                    break;
+                case Operation::Kind::RemoveVertex:
+                    graph.removeVertex(operation.source);
+                    break;
+                case Operation::Kind::InsertEdge:
+                    graph.insertEdge(operation.source, operation.destination, operation.weight);
+                    break;
+                case Operation::Kind::RemoveEdge:
+                    graph.removeEdge(operation.source, operation.destination);
+                    break;
+                }
+            }
+            catch (const std::runtime_error&)
+            {
+                isMatching = false;
+            }
+        return isMatching;
+    }
+
+    //  @brief      Describes a given graph, running its algorithms from every given stride of vertex ids.
+    template <typename Graph>
+    Description describe(const Graph& graph, const VertexId_t stride)
+    {
+        Description description;
+        description.order = graph.getOrder();
+        description.size = graph.getSize();
+        description.edges.resize(graph.getIdBound());
+        description.inDegrees.resize(graph.getIdBound(), SIZE_MAX);
+        for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+        {
+            if (!graph.containsVertex(id))
+                continue;
+            graph.forEachNeighbor(id, [&](const VertexId_t neighbor, const size_t weight)
+                {
+                    description.edges[id].emplace_back(neighbor, weight);
+                });
+            std::sort(description.edges[id].begin(), description.edges[id].end());
+            description.inDegrees[id] = graph.getInDegree(id);
+            if (id % stride != 0)
+                continue;
+            description.distances.push_back(graph.getDijkstraShortestPaths(id));
+            description.depths.push_back(graph.getBFSTree(id, 1).first);
+            description.reachable.push_back(toIds(graph, graph.getDFS(id)));
+            std::sort(description.reachable.back().begin(), description.reachable.back().end());
+        }
+        description.isAcyclic = graph.getKahnTopologicalSort().first;
+        return description;
+    }
+
+    //  @brief      Gets the traversals of a given graph from every given stride of vertex ids.
+    template <typename Graph>
+    Traversals traverse(const Graph& graph, const VertexId_t stride)
+    {
+        Traversals traversals;
+        for (VertexId_t id = 0; id < graph.getIdBound(); id += stride)
+            if (graph.containsVertex(id))
+            {
+                traversals.dfs.push_back(toIds(graph, graph.getDFS(id)));
+                traversals.bfs.push_back(toIds(graph, graph.getBFS(id)));
+            }
+        traversals.topologicalSort = toIds(graph, graph.getKahnTopologicalSort().second);
+        return traversals;
+    }
+
+    //  @brief      Checks whether a graph of a given type, built by given mutations, gives the results of a given reference graph.
+    template <typename Graph>
+    bool isMatchingReference(const GraphWD& reference, const std::vector<Operation>& operations, const bool isOrdered)
+    {
+        Graph graph;
+        const bool isApplied = applyOperations(graph, operations);
+        const bool isDescriptionMatching = describe(graph, 3) == describe(reference, 3);
+        return isApplied && isDescriptionMatching && (!isOrdered || traverse(graph, 3) == traverse(reference, 3));
+    }
+
+    /*
+        @class      FailingResource
+        @brief      Forwards a given number of allocations to the new-delete resource, then throws `std::bad_alloc` on every other one.
+    */
+    class FailingResource final : public std::pmr::memory_resource
+    {
+    private:
+        size_t remainingAllocations = SIZE_MAX;
+
+        void* do_allocate(const size_t bytes, const size_t alignment) override
+        {
+            if (this->remainingAllocations == 0)
+                throw std::bad_alloc();
+            --this->remainingAllocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* const pointer, const size_t bytes, const size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    public:
+        //  @brief      Sets the number of allocations to be forwarded before the next ones throw.
+        void setRemainingAllocations(const size_t count) noexcept
+        {
+            this->remainingAllocations = count;
+        }
+    };
+
+    /*
+        @brief      Inserts a given vertex into a given graph allocating from a given resource, letting the `n`-th allocation fail for every `n`.
+        @returns    `bool` Whether every failed insertion left the graph unchanged, and the final insertion got a given id.
+    */
+    template <typename Graph>
+    bool isInsertionAtomic(Graph& graph, FailingResource& resource, const Vertex_t& vertex, const VertexId_t expectedId)
+    {
+        const Description before = describe(graph, 1);
+        bool isAtomic = true;
+        for (size_t budget = 0; ; ++budget)
+        {
+            resource.setRemainingAllocations(budget);
+            try
+            {
+                const VertexId_t id = graph.insertVertex(vertex);
+                resource.setRemainingAllocations(SIZE_MAX);
+                return isAtomic && budget > 0 && id == expectedId && graph.getVertexName(id) == vertex;
+            }
+            catch (const std::bad_alloc&)
+            {
+                resource.setRemainingAllocations(SIZE_MAX);
+                isAtomic &= !graph.containsVertex(vertex) && describe(graph, 1) == before;
+            }
+        }
+    }
+}
+
+TEST_CASE(storagePoliciesMatchTheReferenceGraph)
+{
+    for (const unsigned seed : { 71u, 73u })
+    {
+        GraphWD reference;
+        const std::vector<Operation> operations = makeOperations(reference, 60, 900, seed);
+        for (const Operation::Kind kind : { Operation::Kind::InsertVertex, Operation::Kind::RemoveVertex, Operation::Kind::RemoveEdge })
+            CHECK(std::ranges::count(operations, kind, &Operation::kind) > 60 / 4);
+        CHECK((isMatchingReference<BasicGraphWD<VertexId_t, std::uint32_t, MapStorage>>(reference, operations, true)));
+        CHECK((isMatchingReference<BasicGraphWD<VertexId_t, std::uint32_t, SortedVectorStorage>>(reference, operations, true)));
+        CHECK((isMatchingReference<BasicGraphWD<VertexId_t, std::uint16_t, SortedVectorStorage>>(reference, operations, true)));
+        CHECK((isMatchingReference<BasicGraphWD<VertexId_t, std::uint32_t, CsrStorage>>(reference, operations, true)));
+        CHECK((isMatchingReference<BasicGraphWD<VertexId_t, std::uint32_t, HashMapStorage>>(reference, operations, false)));
+        CHECK((isMatchingReference<BasicGraphWD<Vertex_t, std::uint32_t, SortedVectorStorage>>(reference, operations, true)));
+        CHECK((isMatchingReference<BasicGraphWD<Vertex_t, std::uint32_t, HashMapStorage>>(reference, operations, false)));
+    }
+}
+
+TEST_CASE(storagePoliciesRejectInvalidMutationsAlike)
+{
+    BasicGraphWD<VertexId_t, std::uint32_t, CsrStorage> graph;
+    graph.insertVertex(0);
+    graph.insertVertex(3);
+    graph.insertEdge(0, 3, 7);
+    CHECK(graph.getIdBound() == 4 && graph.getOrder() == 2);
+    CHECK(!graph.containsVertex(1));
+    CHECK_THROWS(graph.insertVertex(3));
+    CHECK_THROWS(graph.insertEdge(0, 3, 1));
+    CHECK_THROWS(graph.insertEdge(0, 0, 1));
+    CHECK_THROWS(graph.insertEdge(0, 1, 1));
+    CHECK_THROWS(graph.removeEdge(3, 0));
+    CHECK_THROWS(graph.getWeight(3, 0));
+    CHECK(graph.getWeight(0, 3) == 7);
+    graph.removeVertex(3);
+    CHECK(graph.getSize() == 0 && graph.getOutDegree(0) == 0);
+    CHECK_THROWS(graph.removeVertex(3));
+}
+
+TEST_CASE(storagePoliciesInsertVerticesAtomically)
+{
+    FailingResource resource;
+    GraphWD graph(&resource);
+    BasicGraphWD<Vertex_t, std::uint32_t, SortedVectorStorage> basic(&resource);
+    for (const Vertex_t vertex : { "a", "b", "c", "d" })
+    {
+        graph.insertVertex(vertex);
+        basic.insertVertex(vertex);
+    }
+    graph.insertEdge("a", "b", 1);
+    graph.insertEdge("b", "c", 2);
+    basic.insertEdge("a", "b", 1);
+    basic.insertEdge("b", "c", 2);
+    // A new id extends the containers, then a recycled id reuses them.
+    CHECK(isInsertionAtomic(graph, resource, "e", 4));
+    CHECK(isInsertionAtomic(basic, resource, "e", 4));
+    graph.removeVertex("b");
+    basic.removeVertex("b");
+    CHECK(isInsertionAtomic(graph, resource, "f", 1));
+    CHECK(isInsertionAtomic(basic, resource, "f", 1));
+    CHECK(graph.getInDegree("c") == 0 && graph.getOrder() == 5);
+    graph.insertEdge("f", "c", 3);
+    CHECK((graph.getDijkstraShortestPath("f", "c") == std::pair<size_t, std::vector<Vertex_t>>{ 3, { "f", "c" } }));
+}
@@ -0,0 +1,71 @@
+/*
+    @headerfile     TestGraphs.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the random graphs shared by the behavioral tests, and the comparison of their adjacency lists.
+*/
+
+#ifndef __TEST_GRAPHS_HPP_
+#define __TEST_GRAPHS_HPP_
+
+#include <set>
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+#include "GraphWD.hpp"
+
+namespace TestGraphs
+{
+    /*
+        @brief      Creates a random graph of given order and size, named `v0`, `v1`, ..., with weights from 0 to a given bound.
+        @param      order The number of inserted vertices.
+        @param      size The number of attempted edges, of which the self-loops and the duplicates are skipped.
+        @param      maxWeight The maximum weight.
+        @param      seed The seed of the generator.
+        @param      removalStride The stride of the removed vertices `v5`, `v5 + stride`, ..., or 0 to remove none.
+        @returns    `GraphWD` The graph, of which the ids of the removed vertices are free.
+    */
+    inline GraphWD makeRandomGraph(const VertexId_t order, const size_t size, const size_t maxWeight, const unsigned seed,
+        const VertexId_t removalStride = 10)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<VertexId_t> pickVertex(0, order - 1);
+        std::uniform_int_distribution<size_t> pickWeight(0, maxWeight);
+        GraphWD graph;
+        std::set<std::pair<VertexId_t, VertexId_t>> edges;
+        for (VertexId_t vertex = 0; vertex < order; ++vertex)
+            graph.insertVertex("v" + std::to_string(vertex));
+        for (size_t edge = 0; edge < size; ++edge)
+        {
+            const VertexId_t source = pickVertex(generator), destination = pickVertex(generator);
+            const size_t weight = pickWeight(generator);
+            if (source != destination && edges.insert({ source, destination }).second)
+                graph.insertEdge(source, destination, weight);
+        }
+        if (removalStride != 0)
+            for (VertexId_t vertex = 5; vertex < order; vertex += removalStride)
+                graph.removeVertex(vertex);
+        return graph;
+    }
+
+    /*
+        @brief      Gets the outgoing edges of the vertex of a given id, in the order in which a given graph visits them.
+        @param      graph The graph, or any view or snapshot providing `forEachNeighbor`.
+        @param      id The id of the vertex, which must exist.
+        @returns    `std::vector<std::pair<VertexId_t, size_t>>` The neighbor ids and weights.
+    */
+    template <typename Graph>
+    std::vector<std::pair<VertexId_t, size_t>> getEdges(const Graph& graph, const VertexId_t id)
+    {
+        std::vector<std::pair<VertexId_t, size_t>> edges;
+        graph.forEachNeighbor(id, [&](const VertexId_t neighbor, const auto weight)
+            {
+                edges.emplace_back(neighbor, static_cast<size_t>(weight));
+            });
+        return edges;
+    }
+}
+
+#endif // __TEST_GRAPHS_HPP_
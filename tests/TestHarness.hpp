@@ -0,0 +1,81 @@
+/*
+    @headerfile     TestHarness.hpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Defines the minimal harness of the behavioral tests, run by `make test`.
+    @details        `TEST_CASE(name)` defines and registers a test case, and `CHECK(condition)` and `CHECK_THROWS(statement)` fail the running
+    @details        test case, which stops at its first failure. `Tests.cpp` runs every registered test case, or those of which the name contains
+    @details        the first argument of the command line.
+*/
+
+#ifndef __TEST_HARNESS_HPP_
+#define __TEST_HARNESS_HPP_
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+namespace TestHarness
+{
+    //  @struct     TestCase
+    //  @brief      A registered test case.
+    struct TestCase
+    {
+        const char* name;
+        void (*body)(void);
+    };
+
+    //  @class      Failure
+    //  @brief      Thrown by a failing check, and reported with the expression and the location of the check.
+    class Failure final : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    //  @brief      Gets the registered test cases, in registration order.
+    std::vector<TestCase>& getTestCases(void);
+
+    //  @struct     Registrar
+    //  @brief      Registers a test case when constructed, at static initialization.
+    struct Registrar
+    {
+        Registrar(const char* const name, void (*body)(void))
+        {
+            getTestCases().push_back({ name, body });
+        }
+    };
+
+    //  @brief      Fails the running test case, reporting a given failed expression at a given location.
+    [[noreturn]] inline void fail(const char* const expression, const char* const file, const int line)
+    {
+        throw Failure(std::string(file) + ':' + std::to_string(line) + ": `" + expression + "` failed.");
+    }
+}
+
+#define TEST_CASE(name)                                                         \
+    static void name(void);                                                     \
+    static const TestHarness::Registrar name##Registrar(#name, name);           \
+    static void name(void)
+
+#define CHECK(condition)                                                        \
+    ((condition) ? (void)0 : TestHarness::fail(#condition, __FILE__, __LINE__))
+
+#define CHECK_THROWS(statement)                                                 \
+    do                                                                          \
+    {                                                                           \
+        bool isThrown = false;                                                  \
+        try                                                                     \
+        {                                                                       \
+            statement;                                                          \
+        }                                                                       \
+        catch (const std::runtime_error&)                                       \
+        {                                                                       \
+            isThrown = true;                                                    \
+        }                                                                       \
+        if (!isThrown)                                                          \
+            TestHarness::fail(#statement " throws", __FILE__, __LINE__);        \
+    } while (false)
+
+#endif // __TEST_HARNESS_HPP_
@@ -0,0 +1,46 @@
+/*
+    @file           Tests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Runs the behavioral tests registered by the other files of `tests/`, and reports the failing ones.
+    @note           Usage: `tests [filter]`, running the test cases of which the name contains the filter, or all of them.
+    @note           Exits with status 0 if every test case passed, and 1 otherwise.
+*/
+
+#include <string>
+#include <cstring>
+#include <iostream>
+#include <exception>
+#include "TestHarness.hpp"
+#include "TextColors.hpp"
+
+std::vector<TestHarness::TestCase>& TestHarness::getTestCases(void)
+{
+    static std::vector<TestCase> testCases;
+    return testCases;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* const filter = argc > 1 ? argv[1] : "";
+    size_t passed = 0, failed = 0;
+    for (const TestHarness::TestCase& testCase : TestHarness::getTestCases())
+    {
+        if (std::strstr(testCase.name, filter) == nullptr)
+            continue;
+        try
+        {
+            testCase.body();
+            ++passed;
+            std::cout << GREEN_BOLD "[PASS] " DEFAULT_COLOR << testCase.name << '\n';
+        }
+        catch (const std::exception& exception)
+        {
+            ++failed;
+            std::cout << RED_BOLD "[FAIL] " DEFAULT_COLOR << testCase.name << ": " << exception.what() << '\n';
+        }
+    }
+    std::cout << (failed == 0 ? GREEN_BOLD : RED_BOLD) << passed << " passed, " << failed << " failed." DEFAULT_COLOR << std::endl;
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,204 @@
+/*
+    @file           TopologicalOrderTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests the topological order maintained by `GraphWD` across insertions and removals, see `setTopologicalOrderMaintenance`.
+*/
+
+#include <set>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "GraphWD.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Checks whether the maintained order of a given graph lists every vertex once, in increasing positions, and orders every edge.
+    bool isOrderValid(const GraphWD& graph)
+    {
+        const std::vector<VertexId_t> order = graph.getTopologicalOrder();
+        if (order.size() != graph.getOrder())
+            return false;
+        bool isValid = true;
+        for (size_t index = 0; index < order.size(); ++index)
+        {
+            const size_t position = graph.getTopologicalIndex(order[index]);
+            isValid &= graph.containsVertex(order[index]) && (index == 0 || graph.getTopologicalIndex(order[index - 1]) < position);
+            graph.forEachNeighbor(order[index], [&](const VertexId_t neighbor, const size_t)
+                {
+                    isValid &= graph.getTopologicalIndex(neighbor) > position;
+                });
+        }
+        return isValid;
+    }
+
+    //  @brief      Creates a graph of given vertices, inserted in order, maintaining its topological order.
+    GraphWD makeOrderedGraph(const std::vector<Vertex_t>& vertices)
+    {
+        GraphWD graph;
+        graph.setTopologicalOrderMaintenance(true);
+        for (const Vertex_t& vertex : vertices)
+            graph.insertVertex(vertex);
+        return graph;
+    }
+}
+
+TEST_CASE(topologicalOrderFollowsVertexInsertions)
+{
+    const GraphWD graph = makeOrderedGraph({ "a", "b", "c", "d" });
+    CHECK(graph.isTopologicalOrderMaintained());
+    CHECK((graph.getTopologicalOrder() == std::vector<VertexId_t>{ 0, 1, 2, 3 }));
+    CHECK(isOrderValid(graph));
+}
+
+TEST_CASE(topologicalOrderKeepsEdgesAlreadyInOrder)
+{
+    GraphWD graph = makeOrderedGraph({ "v0", "v1", "v2", "v3" });
+    graph.insertEdge("v0", "v3", 1);
+    graph.insertEdge("v1", "v2", 1);
+    CHECK((graph.getTopologicalOrder() == std::vector<VertexId_t>{ 0, 1, 2, 3 }));
+}
+
+TEST_CASE(topologicalOrderReordersOnlyTheAffectedRegion)
+{
+    GraphWD graph = makeOrderedGraph({ "v0", "v1", "v2", "v3", "v4", "v5" });
+    graph.insertEdge("v4", "v1", 1);
+    // Only `v4` and `v1` lie between the destination and the source and are connected to them: they swap positions, the others stay.
+    CHECK((graph.getTopologicalOrder() == std::vector<VertexId_t>{ 0, 4, 2, 3, 1, 5 }));
+    graph.insertEdge("v1", "v2", 1);
+    CHECK((graph.getTopologicalOrder() == std::vector<VertexId_t>{ 0, 4, 1, 3, 2, 5 }));
+    CHECK(isOrderValid(graph));
+}
+
+TEST_CASE(topologicalOrderMovesDescendantsAndAncestorsTogether)
+{
+    GraphWD graph = makeOrderedGraph({ "a", "b", "c", "d", "e" });
+    graph.insertEdge("a", "b", 1);
+    graph.insertEdge("d", "e", 1);
+    graph.insertEdge("c", "d", 1);
+    graph.insertEdge("e", "a", 1);
+    // `a -> b` must follow `e`, and `c -> d -> e` must precede `a`.
+    CHECK(isOrderValid(graph));
+    CHECK(graph.getTopologicalIndex("c") < graph.getTopologicalIndex("a"));
+    CHECK(graph.getTopologicalIndex("e") < graph.getTopologicalIndex("b"));
+}
+
+TEST_CASE(topologicalOrderRejectsCycles)
+{
+    GraphWD graph = makeOrderedGraph({ "a", "b", "c", "d" });
+    graph.insertEdge("a", "b", 1);
+    graph.insertEdge("b", "c", 1);
+    graph.insertEdge("c", "d", 1);
+    const std::vector<VertexId_t> order = graph.getTopologicalOrder();
+    const size_t version = graph.getVersion();
+    CHECK_THROWS(graph.insertEdge("d", "a", 1));
+    CHECK_THROWS(graph.insertEdge("c", "b", 1));
+    CHECK(graph.getSize() == 3);
+    CHECK(graph.getVersion() == version);
+    CHECK(graph.getTopologicalOrder() == order);
+    CHECK_THROWS(graph.getWeight("d", "a"));
+    graph.insertEdge("a", "d", 1);
+    CHECK(isOrderValid(graph));
+}
+
+TEST_CASE(topologicalOrderCannotBeEnabledOnCyclicGraphs)
+{
+    GraphWD graph;
+    graph.insertVertex("a");
+    graph.insertVertex("b");
+    graph.insertEdge("a", "b", 1);
+    graph.insertEdge("b", "a", 1);
+    CHECK_THROWS(graph.setTopologicalOrderMaintenance(true));
+    CHECK(!graph.isTopologicalOrderMaintained());
+    CHECK_THROWS(graph.getTopologicalOrder());
+    CHECK_THROWS(graph.getTopologicalIndex("a"));
+    graph.removeEdge("b", "a");
+    graph.setTopologicalOrderMaintenance(true);
+    CHECK(graph.getTopologicalIndex("a") < graph.getTopologicalIndex("b"));
+}
+
+TEST_CASE(topologicalOrderSurvivesVertexRemovals)
+{
+    GraphWD graph = makeOrderedGraph({ "a", "b", "c", "d" });
+    graph.insertEdge("d", "a", 1);
+    graph.insertEdge("c", "b", 1);
+    graph.removeVertex("c");
+    CHECK(isOrderValid(graph));
+    graph.insertVertex("e");
+    graph.insertEdge("b", "e", 1);
+    graph.insertEdge("e", "d", 1);
+    CHECK(isOrderValid(graph));
+    CHECK(graph.getTopologicalIndex("b") < graph.getTopologicalIndex("a"));
+}
+
+TEST_CASE(topologicalOrderCompactsTheTombstonesOfRemovedVertices)
+{
+    constexpr VertexId_t ORDER = 40;
+    GraphWD graph;
+    for (VertexId_t vertex = 0; vertex < ORDER; ++vertex)
+        graph.insertVertex("v" + std::to_string(vertex));
+    graph.setTopologicalOrderMaintenance(true);
+    for (VertexId_t vertex = 1; vertex < ORDER; ++vertex)
+        graph.insertEdge(vertex, vertex - 1, 1);
+    graph.removeVertex("v38");
+    CHECK(graph.getTopologicalIndex("v39") == 0);
+    CHECK(graph.getTopologicalIndex("v37") == 2);
+    CHECK(isOrderValid(graph));
+    for (VertexId_t vertex = 0; vertex < ORDER; vertex += 2)
+        if (vertex != 38)
+            graph.removeVertex(vertex);
+    CHECK(isOrderValid(graph));
+    for (VertexId_t vertex = 1; vertex < ORDER - 10; vertex += 2)
+        graph.removeVertex(vertex);
+    CHECK(isOrderValid(graph));
+    CHECK(graph.getOrder() == 5);
+    CHECK(graph.getTopologicalIndex("v39") < graph.getTopologicalIndex("v31"));
+    CHECK(graph.getTopologicalIndex("v31") < graph.getOrder());
+    graph.insertVertex("w");
+    graph.insertEdge("v31", "w", 1);
+    graph.insertEdge("w", "v35", 1);
+    CHECK(isOrderValid(graph));
+    CHECK(graph.getTopologicalIndex("w") < graph.getTopologicalIndex("v35"));
+    CHECK((graph.getTopologicalOrder() == std::vector<VertexId_t>{ 39, 37, 31, 33, graph.getVertexId("w"), 35 }));
+}
+
+TEST_CASE(topologicalOrderMatchesReachabilityOnRandomInsertions)
+{
+    constexpr VertexId_t ORDER = 60;
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<VertexId_t> pickVertex(0, ORDER - 1);
+    GraphWD graph;
+    for (VertexId_t vertex = 0; vertex < ORDER; ++vertex)
+        graph.insertVertex("v" + std::to_string(vertex));
+    graph.setTopologicalOrderMaintenance(true);
+    std::set<std::pair<VertexId_t, VertexId_t>> edges;
+    size_t rejected = 0;
+    for (size_t attempt = 0; attempt < 600; ++attempt)
+    {
+        const VertexId_t source = pickVertex(generator), destination = pickVertex(generator);
+        if (source == destination || edges.contains({ source, destination }))
+            continue;
+        const std::vector<VertexId_t> reachable = graph.getBFS(destination);
+        if (std::find(reachable.begin(), reachable.end(), source) != reachable.end())
+        {
+            const size_t size = graph.getSize();
+            CHECK_THROWS(graph.insertEdge(source, destination, 1));
+            CHECK(graph.getSize() == size);
+            ++rejected;
+            continue;
+        }
+        graph.insertEdge(source, destination, 1);
+        edges.insert({ source, destination });
+        if (attempt % 50 == 0)
+        {
+            graph.removeEdge(source, destination);
+            edges.erase({ source, destination });
+        }
+        CHECK(isOrderValid(graph));
+    }
+    CHECK(rejected > 0);
+    CHECK(graph.getKahnTopologicalSort().first);
+}
@@ -0,0 +1,144 @@
+/*
+    @file           TraversalRangesTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that the lazy traversal ranges yield the vertices of `getDFS` and `getBFS` in the same order, with consistent depths
+    @brief          and parents, and only scan the edges of the vertices they advance past.
+*/
+
+#include <ranges>
+#include <string>
+#include <vector>
+#include "GraphWD.hpp"
+#include "GraphWDView.hpp"
+#include "TraversalRanges.hpp"
+#include "TestGraphs.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    /*
+        @class      ScanCountingGraph
+        @brief      Exposes a graph while counting the vertices of which the outgoing edges are scanned.
+    */
+    class ScanCountingGraph final
+    {
+    private:
+        const GraphWD& graph;
+        mutable size_t scanCount = 0;
+
+    public:
+        explicit ScanCountingGraph(const GraphWD& graph) : graph(graph)
+        {
+        }
+
+        VertexId_t getIdBound(void) const noexcept
+        {
+            return this->graph.getIdBound();
+        }
+
+        template <typename Visitor>
+        void forEachNeighbor(const VertexId_t id, Visitor&& visitor) const
+        {
+            ++this->scanCount;
+            this->graph.forEachNeighbor(id, visitor);
+        }
+
+        size_t getScanCount(void) const noexcept
+        {
+            return this->scanCount;
+        }
+    };
+
+    //  @brief      Gets the ids of the steps of a given range, checking that each step but the first is reached through an edge from its parent.
+    template <typename Graph, typename Range>
+    std::vector<VertexId_t> getIds(const Graph& graph, Range&& range, bool& isConsistent)
+    {
+        std::vector<VertexId_t> ids;
+        std::vector<size_t> depths(graph.getIdBound(), SIZE_MAX);
+        for (const TraversalStep& step : range)
+        {
+            if (ids.empty())
+                isConsistent &= step.parent == step.id && step.depth == 0;
+            else
+            {
+                isConsistent &= depths[step.parent] != SIZE_MAX && step.depth == depths[step.parent] + 1;
+                bool isEdge = false;
+                graph.forEachNeighbor(step.parent, [&](const VertexId_t neighbor, const size_t)
+                    {
+                        isEdge |= neighbor == step.id;
+                    });
+                isConsistent &= isEdge;
+            }
+            depths[step.id] = step.depth;
+            ids.push_back(step.id);
+        }
+        return ids;
+    }
+}
+
+TEST_CASE(traversalRangesMatchTheEagerTraversals)
+{
+    const GraphWD graph = TestGraphs::makeRandomGraph(150, 400, 9, 59);
+    const GraphWDView view = graph.freeze();
+    bool isConsistent = true;
+    for (VertexId_t start = 0; start < graph.getIdBound(); start += 4)
+    {
+        if (!graph.containsVertex(start))
+            continue;
+        const Vertex_t name = graph.getVertexName(start);
+        CHECK(getIds(graph, graph.getDFSRange(start), isConsistent) == graph.getDFS(start));
+        CHECK(getIds(graph, graph.getBFSRange(name), isConsistent) == graph.getBFS(start));
+        CHECK(getIds(view, view.getDFSRange(name), isConsistent) == graph.getDFS(start));
+        CHECK(getIds(view, view.getBFSRange(start), isConsistent) == graph.getBFS(start));
+    }
+    CHECK(isConsistent);
+    CHECK_THROWS(graph.getDFSRange("missing"));
+    CHECK_THROWS(graph.getBFSRange(VertexId_t(5)));
+    CHECK_THROWS(view.getBFSRange(graph.getIdBound()));
+}
+
+TEST_CASE(traversalRangesMatchBreadthFirstDepths)
+{
+    // Enough vertices for the consumed entries of the breadth-first queue to be compacted.
+    const GraphWD graph = TestGraphs::makeRandomGraph(9000, 40000, 1, 61);
+    const auto [depths, parents] = graph.getBFSTree(VertexId_t(0), 1);
+    bool isMatching = true;
+    std::vector<VertexId_t> ids;
+    for (const TraversalStep& step : graph.getBFSRange(VertexId_t(0)))
+    {
+        isMatching &= step.depth == depths[step.id];
+        ids.push_back(step.id);
+    }
+    CHECK(isMatching);
+    CHECK(ids == graph.getBFS(VertexId_t(0)));
+}
+
+TEST_CASE(traversalRangesOnlyScanTheVerticesAdvancedPast)
+{
+    const GraphWD graph = TestGraphs::makeRandomGraph(200, 1200, 9, 67);
+    VertexId_t start = 0;
+    while (graph.getOutDegree(start) == 0)
+        ++start;
+    const ScanCountingGraph counting(graph);
+    std::vector<VertexId_t> prefix;
+    for (const TraversalStep& step : GraphKernels::BfsRange<ScanCountingGraph>(counting, start) | std::views::take(10))
+        prefix.push_back(step.id);
+    const std::vector<VertexId_t> traversal = graph.getBFS(start);
+    CHECK(traversal.size() > 10);
+    CHECK((prefix == std::vector<VertexId_t>(traversal.begin(), traversal.begin() + 10)));
+    CHECK(counting.getScanCount() <= 10);
+    const auto isOdd = [](const TraversalStep& step)
+        {
+            return step.id % 2 == 1;
+        };
+    std::vector<VertexId_t> odd;
+    for (const TraversalStep& step : graph.getDFSRange(start) | std::views::filter(isOdd))
+        odd.push_back(step.id);
+    std::vector<VertexId_t> expected;
+    for (const VertexId_t id : graph.getDFS(start))
+        if (id % 2 == 1)
+            expected.push_back(id);
+    CHECK(odd == expected);
+}
@@ -0,0 +1,107 @@
+/*
+    @file           VertexInterningTests.cpp
+    @version        1.0
+    @author         Ahmad Mzayek
+    @date           Friday, October 16th, 2026
+    @brief          Tests that the id-based overloads of `GraphWD` agree with the vertex-based ones, including for the recycled ids of removed vertices.
+*/
+
+#include <map>
+#include <string>
+#include <vector>
+#include "GraphWD.hpp"
+#include "TestGraphs.hpp"
+#include "TestHarness.hpp"
+
+namespace
+{
+    //  @brief      Gets the names of given vertex ids in a given graph.
+    std::vector<Vertex_t> getNames(const GraphWD& graph, const std::vector<VertexId_t>& ids)
+    {
+        std::vector<Vertex_t> names;
+        for (const VertexId_t id : ids)
+            names.push_back(graph.getVertexName(id));
+        return names;
+    }
+
+    //  @brief      Checks whether the id-based and the vertex-based overloads of a given graph agree for every vertex.
+    bool areOverloadsAgreeing(const GraphWD& graph)
+    {
+        bool isAgreeing = true;
+        for (VertexId_t id = 0; id < graph.getIdBound(); ++id)
+        {
+            if (!graph.containsVertex(id))
+                continue;
+            const Vertex_t name = graph.getVertexName(id);
+            isAgreeing &= graph.containsVertex(name) && graph.getVertexId(name) == id;
+            isAgreeing &= graph.getInDegree(name) == graph.getInDegree(id) && graph.getOutDegree(name) == graph.getOutDegree(id);
+            isAgreeing &= getNames(graph, graph.getDFS(id)) == graph.getDFS(name);
+            isAgreeing &= getNames(graph, graph.getBFS(id)) == graph.getBFS(name);
+            isAgreeing &= graph.isConnected(id) == graph.isConnected(name);
+            const std::vector<size_t> distances = graph.getDijkstraShortestPaths(id);
+            for (const auto& [vertex, distance] : graph.getDijkstraShortestPaths(name))
+                isAgreeing &= distances[graph.getVertexId(vertex)] == distance;
+            graph.forEachNeighbor(id, [&](const VertexId_t neighbor, const size_t weight)
+                {
+                    isAgreeing &= graph.getWeight(name, graph.getVertexName(neighbor)) == weight && graph.getWeight(id, neighbor) == weight;
+                });
+        }
+        return isAgreeing;
+    }
+}
+
+TEST_CASE(internedOverloadsAgreeOnRandomGraphs)
+{
+    const GraphWD graph = TestGraphs::makeRandomGraph(90, 400, 30, 17);
+    CHECK(areOverloadsAgreeing(graph));
+    CHECK(!graph.containsVertex(VertexId_t(5)));
+    CHECK(!graph.containsVertex(graph.getIdBound()));
+    CHECK_THROWS(graph.getOutDegree(VertexId_t(5)));
+    CHECK_THROWS(graph.getVertexName(graph.getIdBound()));
+    CHECK_THROWS(graph.getVertexId("v5"));
+}
+
+TEST_CASE(internedIdsAreRecycledAfterRemovals)
+{
+    GraphWD graph;
+    for (const Vertex_t vertex : { "a", "b", "c", "d" })
+        graph.insertVertex(vertex);
+    graph.insertEdge("a", "b", 1);
+    graph.insertEdge("b", "c", 2);
+    graph.insertEdge("c", "d", 3);
+    const VertexId_t removed = graph.getVertexId("b");
+    graph.removeVertex("b");
+    CHECK(!graph.containsVertex(removed));
+    CHECK(!graph.containsVertex("b"));
+    const VertexId_t recycled = graph.insertVertex("e");
+    CHECK(recycled == removed);
+    CHECK(graph.getIdBound() == 4);
+    CHECK(graph.getVertexName(recycled) == "e");
+    CHECK(graph.getInDegree("e") == 0 && graph.getOutDegree("e") == 0);
+    CHECK(graph.getInDegree("c") == 0);
+    CHECK_THROWS(graph.getWeight("a", "e"));
+    graph.insertEdge("e", "a", 4);
+    graph.insertEdge("d", "e", 5);
+    CHECK(graph.getWeight(recycled, graph.getVertexId("a")) == 4);
+    CHECK(graph.getDijkstraShortestPaths("c").at("a") == 12);
+    CHECK(areOverloadsAgreeing(graph));
+    graph.insertVertex("b");
+    CHECK(graph.getVertexId("b") == 4);
+    CHECK(areOverloadsAgreeing(graph));
+}
+
+TEST_CASE(internedVerticesAreVisitedInIdOrder)
+{
+    GraphWD graph;
+    for (const Vertex_t vertex : { "root", "z", "y", "x" })
+        graph.insertVertex(vertex);
+    graph.insertEdge("root", "x", 1);
+    graph.insertEdge("root", "y", 1);
+    graph.insertEdge("root", "z", 1);
+    CHECK((graph.getBFS("root") == std::vector<Vertex_t>{ "root", "z", "y", "x" }));
+    CHECK((graph.getKahnTopologicalSort().second == std::vector<Vertex_t>{ "root", "z", "y", "x" }));
+    graph.removeVertex("z");
+    graph.insertVertex("w");
+    graph.insertEdge("root", "w", 1);
+    CHECK((graph.getBFS("root") == std::vector<Vertex_t>{ "root", "w", "y", "x" }));
+}